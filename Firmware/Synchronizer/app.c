@@ -3,7 +3,10 @@
 #include "hwbp_core_types.h"
 
 #include "app.h"
+#include "app_funcs.h"
 #include "app_ios_and_regs.h"
+#include "input_fifo.h"
+#include "input_batch.h"
 
 
 /************************************************************************/
@@ -28,7 +31,7 @@ void hwbp_app_initialize(void)
     uint8_t hwH = 1;
     uint8_t hwL;
     uint8_t fwH = 1;
-    uint8_t fwL = 7;
+    uint8_t fwL = 8;
     uint8_t ass = 0;
     
     io_pin2in(&PORTB, 3, PULL_IO_UP, SENSE_IO_EDGES_BOTH);
@@ -58,6 +61,77 @@ void hwbp_app_initialize(void)
    	);
 }
 
+/************************************************************************/
+/* Process the inputs' readings and send the events                     */
+/************************************************************************/
+static volatile bool edge_count_event_pending = false;
+static volatile bool telemetry_event_pending = false;
+void hwbp_app_dispatch_events(void)
+{
+	input_reading_t reading;
+	
+	update_dead_time();
+	logic_table_update();
+	
+	if (edge_count_event_pending)
+	{
+		edge_count_event_pending = false;
+		core_func_send_event(ADD_REG_INPUTS_EDGE_COUNT, true);
+		
+		uint8_t sreg = SREG;
+		cli();
+		telemetry_event_sent();
+		SREG = sreg;
+	}
+	
+	if (telemetry_event_pending)
+	{
+		telemetry_event_pending = false;
+		
+		uint8_t sreg = SREG;
+		cli();
+		telemetry_update();
+		telemetry_event_sent();
+		SREG = sreg;
+		
+		core_func_send_event(ADD_REG_TELEMETRY, true);
+	}
+	
+	while (input_fifo_pop(&reading))
+		process(&reading);
+	
+	if (input_batch_peek())
+	{
+		uint32_t second;
+		uint16_t usecond;
+		uint8_t sreg = SREG;
+		cli();
+		
+		/* Check again since the catch mode may have been changed meanwhile */
+		input_batch_t *batch = input_batch_peek();
+		
+		if (batch)
+		{
+			app_regs.REG_INPUTS_STATE_BATCH[0] = batch->period;
+			for (uint8_t i = 0; i < INPUT_BATCH_LENGTH; i++)
+				app_regs.REG_INPUTS_STATE_BATCH[i + 1] = batch->state[i];
+			
+			second = batch->second;
+			usecond = batch->usecond;
+			input_batch_release();
+			telemetry_event_sent();
+		}
+		
+		SREG = sreg;
+		
+		if (batch)
+		{
+			core_func_update_user_timestamp(second, usecond);
+			core_func_send_event(ADD_REG_INPUTS_STATE_BATCH, false);
+		}
+	}
+}
+
 /************************************************************************/
 /* Handle if a catastrophic error occur                                 */
 /************************************************************************/
@@ -105,12 +179,91 @@ void core_callback_reset_registers(void)
 	app_regs.REG_INPUT_CATCH_MODE = GM_INMODE_WHEN_ANY_CHANGE;
 	app_regs.REG_OUTPUT_MODE = GM_OUTMODE_TOGGLE;
 	app_regs.REG_EVNT_ENABLE = B_EVT0;
+	app_regs.REG_EVENT_QUEUE_OVERFLOWS = 0;
+	app_regs.REG_SAMPLING_PERIOD = 1000;
+	app_regs.REG_SAMPLING_EVENT_MODE = GM_SAMPLING_EVERY_SAMPLE;
+	app_regs.REG_KEYFRAME_INTERVAL = 0;
+	app_regs.REG_INPUTS_RISING_EDGE = MSK_INPUTS;
+	app_regs.REG_INPUTS_FALLING_EDGE = MSK_INPUTS;
+	for (uint8_t i = 0; i < 9; i++)
+		app_regs.REG_INPUTS_DEAD_TIME[i] = 0;
+	app_regs.REG_EDGE_COUNT_EVENT_PERIOD = 1000;
+	app_regs.REG_PULSE_WIDTH = 1000;
+	app_regs.REG_LOGIC_MASK = MSK_INPUTS;
+	app_regs.REG_LOGIC_FUNCTION = GM_LOGIC_OR;
+	app_regs.REG_LOGIC_THRESHOLD = 1;
+	app_regs.REG_LOGIC_RESET_MASK = 0;
+	app_regs.REG_TRIGGER_RISING_EDGE = 0;
+	app_regs.REG_TRIGGER_FALLING_EDGE = 0;
+	app_regs.REG_TRIGGER_PATTERN_MASK = 0;
+	app_regs.REG_TRIGGER_PATTERN = 0;
+	app_regs.REG_TRIGGER_DELAY = 0;
+	app_regs.REG_TRIGGER_REARM_MODE = GM_TRIGGER_REARM_AFTER_PULSE;
+	app_regs.REG_TRIGGER_ARM = 0;
+	for (uint8_t i = 0; i < 32; i++)
+		app_regs.REG_PATTERN[i] = 0;
+	app_regs.REG_PATTERN_REPEAT = 1;
+	app_regs.REG_PATTERN_TRIGGER = 0;
+	app_regs.REG_PATTERN_CONTROL = 0;
+	app_regs.REG_INPUTS_INT_LEVEL = INT_LEVEL_LOW;
+	app_regs.REG_CAPTURE_LATENCY_MAX = 0;
+	app_regs.REG_TELEMETRY_EVENT_PERIOD = 1000;
 }
 
 void core_callback_registers_were_reinitialized(void)
 {
+	/* Clear the events' queue */
+	input_fifo_flush();
+	app_regs.REG_EVENT_QUEUE_OVERFLOWS = 0;
+	app_regs.REG_CAPTURE_LATENCY_MAX = 0;
+	for (uint8_t i = 0; i < 9; i++)
+	{
+		app_regs.REG_INPUTS_GLITCHES[i] = 0;
+		app_regs.REG_INPUTS_EDGE_COUNT[i] = 0;
+		app_regs.REG_INPUTS_PERIOD[i] = 0;
+	}
+	if (app_regs.REG_EDGE_COUNT_EVENT_PERIOD == 0)
+		app_regs.REG_EDGE_COUNT_EVENT_PERIOD = 1000;
+	if (app_regs.REG_TELEMETRY_EVENT_PERIOD == 0)
+		app_regs.REG_TELEMETRY_EVENT_PERIOD = 1000;
+	telemetry_reset();
+
+	/* Configure the inputs' catch mode */
+	if (app_regs.REG_INPUTS_INT_LEVEL < INT_LEVEL_LOW || app_regs.REG_INPUTS_INT_LEVEL > INT_LEVEL_HIGH)
+		app_regs.REG_INPUTS_INT_LEVEL = INT_LEVEL_LOW;
+	if (!app_write_REG_SAMPLING_PERIOD(&app_regs.REG_SAMPLING_PERIOD))
+		app_regs.REG_SAMPLING_PERIOD = 1000;
+	app_regs.REG_INPUTS_RISING_EDGE &= MSK_INPUTS;
+	app_regs.REG_INPUTS_FALLING_EDGE &= MSK_INPUTS;
+	app_write_REG_INPUT_CATCH_MODE(&app_regs.REG_INPUT_CATCH_MODE);
+
+	/* Configure the output 0 mode */
+	if (app_regs.REG_PULSE_WIDTH == 0)
+		app_regs.REG_PULSE_WIDTH = 1000;
+	app_regs.REG_LOGIC_MASK &= MSK_INPUTS;
+	app_regs.REG_LOGIC_RESET_MASK &= MSK_INPUTS;
+	if (!app_write_REG_LOGIC_THRESHOLD(&app_regs.REG_LOGIC_THRESHOLD))
+		app_regs.REG_LOGIC_THRESHOLD = 1;
+	if (app_regs.REG_LOGIC_FUNCTION > GM_LOGIC_SET_RESET)
+		app_regs.REG_LOGIC_FUNCTION = GM_LOGIC_OR;
+	app_write_REG_LOGIC_FUNCTION(&app_regs.REG_LOGIC_FUNCTION);
+	app_regs.REG_TRIGGER_RISING_EDGE &= MSK_INPUTS;
+	app_regs.REG_TRIGGER_FALLING_EDGE &= MSK_INPUTS;
+	app_regs.REG_TRIGGER_PATTERN_MASK &= MSK_INPUTS;
+	app_regs.REG_TRIGGER_PATTERN &= MSK_INPUTS;
+	if (app_regs.REG_TRIGGER_REARM_MODE > GM_TRIGGER_REARM_MANUAL)
+		app_regs.REG_TRIGGER_REARM_MODE = GM_TRIGGER_REARM_AFTER_PULSE;
+	if (!app_write_REG_PATTERN(app_regs.REG_PATTERN))
+	{
+		app_regs.REG_PATTERN[0] = 0;
+		app_write_REG_PATTERN(app_regs.REG_PATTERN);
+	}
+	app_regs.REG_PATTERN_TRIGGER &= MSK_INPUTS;
+	if (!app_write_REG_OUTPUT_MODE(&app_regs.REG_OUTPUT_MODE))
+		app_regs.REG_OUTPUT_MODE = GM_OUTMODE_TOGGLE;
+
 	/* Update registers, output 0 and output LED */
-	app_regs.REG_INPUTS_STATE = ((~PORTA_IN) & 0x3F) | (((~PORTB_IN) & 0x7) << 6) | (PORTC_IN & 0x01 ? 0x2000 : 0) | (PORTA_IN & 0x80 ? 0x4000 : 0) | (PORTC_IN & 0x02 ? 0x8000 : 0);
+	inputs_state_reset();
 	if ((app_regs.REG_OUTPUT_MODE & MSK_OUTPUT_MODE) == GM_OUTMODE_INPUT0)
 	{
 		if (!read_INPUT0)
@@ -133,8 +286,7 @@ void core_callback_registers_were_reinitialized(void)
 	/* Update LEDs */
 	if (core_bool_is_visual_enabled())
 	{
-		PORTD_OUT = (PORTA_IN & 0x3F);
-		PORTC_OUT = (PORTC_OUT & 0x8F) | ((PORTB_IN & 0x7) << 4);
+		update_inputs_leds(app_regs.REG_INPUTS_STATE);
 	}
 }
 
@@ -143,8 +295,7 @@ void core_callback_registers_were_reinitialized(void)
 /************************************************************************/
 void core_callback_visualen_to_on(void)
 {
-	PORTD_OUT = (PORTA_IN & 0x3F);
-	PORTC_OUT = (PORTC_OUT & 0x8F) | ((PORTB_IN & 0x7) << 4);
+	update_inputs_leds(read_inputs_state());
 
 	if (read_OUTPUT0)
 		set_LEDOUT0;
@@ -155,7 +306,7 @@ void core_callback_visualen_to_on(void)
 void core_callback_visualen_to_off(void)
 {
 	PORTD_OUT |= 0x3F;
-	PORTB_OUT |= 0x07;
+	PORTC_OUT |= 0x70;
 	clr_LEDOUT0;
 }
 
@@ -170,7 +321,6 @@ void core_callback_device_to_speed(void) {}
 /************************************************************************/
 /* Callbacks: 1 ms timer                                                */
 /************************************************************************/
-extern void read(bool filter_equal_readings);
 uint16_t catch_counter = 0;
 void core_callback_t_before_exec(void)
 {
@@ -180,26 +330,28 @@ void core_callback_t_before_exec(void)
 		{
 			case GM_INMODE_100Hz:
 				if ((catch_counter++ % 20) == 0)
-					read(false);
+					latch(INPUT_READING_SAMPLE, 0);
 				break;
 								
 			case GM_INMODE_250Hz:
 				if ((catch_counter++ % 8) == 0)
-					read(false);
+					latch(INPUT_READING_SAMPLE, 0);
 				break;
 				
 			case GM_INMODE_500Hz:
 				if ((catch_counter++ % 4) == 0)
-					read(false);
+					latch(INPUT_READING_SAMPLE, 0);
 				break;
 				
 			case GM_INMODE_1000Hz:
+			case GM_INMODE_1000Hz_BATCH:
 				if ((catch_counter++ % 2) == 0)
-					read(false);
+					latch(INPUT_READING_SAMPLE, 0);
 				break;
 				
 			case GM_INMODE_2000Hz:
-				read(false);
+			case GM_INMODE_2000Hz_BATCH:
+				latch(INPUT_READING_SAMPLE, 0);
 				break;
 		}
 	}
@@ -210,7 +362,28 @@ void core_callback_t_new_second(void)
 	catch_counter = 0;
 }
 void core_callback_t_500us(void) {}
-void core_callback_t_1ms(void) {}
+uint16_t edge_count_counter = 0;
+uint16_t telemetry_counter = 0;
+void core_callback_t_1ms(void)
+{
+	if (app_regs.REG_EVNT_ENABLE & B_EVT1)
+	{
+		if (++edge_count_counter >= app_regs.REG_EDGE_COUNT_EVENT_PERIOD)
+		{
+			edge_count_counter = 0;
+			edge_count_event_pending = true;
+		}
+	}
+	
+	if (app_regs.REG_EVNT_ENABLE & B_EVT2)
+	{
+		if (++telemetry_counter >= app_regs.REG_TELEMETRY_EVENT_PERIOD)
+		{
+			telemetry_counter = 0;
+			telemetry_event_pending = true;
+		}
+	}
+}
 
 /************************************************************************/
 /* Callbacks: clock control                                             */
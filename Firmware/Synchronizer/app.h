@@ -15,4 +15,10 @@
 void hwbp_app_initialize(void);
 
 
+/************************************************************************/
+/* Process the inputs' readings and send the events (main loop)         */
+/************************************************************************/
+void hwbp_app_dispatch_events(void);
+
+
 #endif /* _APP_H_ */
\ No newline at end of file
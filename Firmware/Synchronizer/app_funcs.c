@@ -1,6 +1,8 @@
 #include "app_funcs.h"
 #include "app_ios_and_regs.h"
 #include "hwbp_core.h"
+#include "input_fifo.h"
+#include "input_batch.h"
 
 
 /************************************************************************/
@@ -17,7 +19,39 @@ void (*app_func_rd_pointer[])(void) = {
 	&app_read_REG_RESERVED1,
 	&app_read_REG_RESERVED2,
 	&app_read_REG_RESERVED3,
-	&app_read_REG_EVNT_ENABLE
+	&app_read_REG_EVNT_ENABLE,
+	&app_read_REG_EVENT_QUEUE_OVERFLOWS,
+	&app_read_REG_INPUTS_STATE_BATCH,
+	&app_read_REG_SAMPLING_PERIOD,
+	&app_read_REG_SAMPLING_EVENT_MODE,
+	&app_read_REG_KEYFRAME_INTERVAL,
+	&app_read_REG_INPUTS_RISING_EDGE,
+	&app_read_REG_INPUTS_FALLING_EDGE,
+	&app_read_REG_INPUTS_DEAD_TIME,
+	&app_read_REG_INPUTS_GLITCHES,
+	&app_read_REG_INPUTS_EDGE_COUNT,
+	&app_read_REG_INPUTS_PERIOD,
+	&app_read_REG_EDGE_COUNT_EVENT_PERIOD,
+	&app_read_REG_PULSE_WIDTH,
+	&app_read_REG_LOGIC_MASK,
+	&app_read_REG_LOGIC_FUNCTION,
+	&app_read_REG_LOGIC_THRESHOLD,
+	&app_read_REG_LOGIC_RESET_MASK,
+	&app_read_REG_TRIGGER_RISING_EDGE,
+	&app_read_REG_TRIGGER_FALLING_EDGE,
+	&app_read_REG_TRIGGER_PATTERN_MASK,
+	&app_read_REG_TRIGGER_PATTERN,
+	&app_read_REG_TRIGGER_DELAY,
+	&app_read_REG_TRIGGER_REARM_MODE,
+	&app_read_REG_TRIGGER_ARM,
+	&app_read_REG_PATTERN,
+	&app_read_REG_PATTERN_REPEAT,
+	&app_read_REG_PATTERN_TRIGGER,
+	&app_read_REG_PATTERN_CONTROL,
+	&app_read_REG_INPUTS_INT_LEVEL,
+	&app_read_REG_CAPTURE_LATENCY_MAX,
+	&app_read_REG_TELEMETRY,
+	&app_read_REG_TELEMETRY_EVENT_PERIOD
 };
 
 bool (*app_func_wr_pointer[])(void*) = {
@@ -29,247 +63,1790 @@ bool (*app_func_wr_pointer[])(void*) = {
 	&app_write_REG_RESERVED1,
 	&app_write_REG_RESERVED2,
 	&app_write_REG_RESERVED3,
-	&app_write_REG_EVNT_ENABLE
+	&app_write_REG_EVNT_ENABLE,
+	&app_write_REG_EVENT_QUEUE_OVERFLOWS,
+	&app_write_REG_INPUTS_STATE_BATCH,
+	&app_write_REG_SAMPLING_PERIOD,
+	&app_write_REG_SAMPLING_EVENT_MODE,
+	&app_write_REG_KEYFRAME_INTERVAL,
+	&app_write_REG_INPUTS_RISING_EDGE,
+	&app_write_REG_INPUTS_FALLING_EDGE,
+	&app_write_REG_INPUTS_DEAD_TIME,
+	&app_write_REG_INPUTS_GLITCHES,
+	&app_write_REG_INPUTS_EDGE_COUNT,
+	&app_write_REG_INPUTS_PERIOD,
+	&app_write_REG_EDGE_COUNT_EVENT_PERIOD,
+	&app_write_REG_PULSE_WIDTH,
+	&app_write_REG_LOGIC_MASK,
+	&app_write_REG_LOGIC_FUNCTION,
+	&app_write_REG_LOGIC_THRESHOLD,
+	&app_write_REG_LOGIC_RESET_MASK,
+	&app_write_REG_TRIGGER_RISING_EDGE,
+	&app_write_REG_TRIGGER_FALLING_EDGE,
+	&app_write_REG_TRIGGER_PATTERN_MASK,
+	&app_write_REG_TRIGGER_PATTERN,
+	&app_write_REG_TRIGGER_DELAY,
+	&app_write_REG_TRIGGER_REARM_MODE,
+	&app_write_REG_TRIGGER_ARM,
+	&app_write_REG_PATTERN,
+	&app_write_REG_PATTERN_REPEAT,
+	&app_write_REG_PATTERN_TRIGGER,
+	&app_write_REG_PATTERN_CONTROL,
+	&app_write_REG_INPUTS_INT_LEVEL,
+	&app_write_REG_CAPTURE_LATENCY_MAX,
+	&app_write_REG_TELEMETRY,
+	&app_write_REG_TELEMETRY_EVENT_PERIOD
 };
 
 
+/************************************************************************/
+/* Inputs' edges                                                        */
+/************************************************************************/
+/* The inputs are inverted, so the rising edge of an input is a falling
+ * edge on the pin. Disabled inputs are removed from the interrupt masks.
+ * The interrupts use the level of register INPUTS_INT_LEVEL. */
+#define INPUTS_OF_PORTA_INT1 0x001
+#define INPUTS_OF_PORTA_INT0 0x03E
+#define INPUTS_OF_PORTB_INT0 0x1C0
+
+static uint16_t edges_rising = MSK_INPUTS;
+static uint16_t edges_falling = MSK_INPUTS;
+static uint16_t inputs_locked = 0;
+
+/* Inputs followed by the output mode, which interrupt on both edges
+ * whatever the catch mode is */
+static uint16_t output_inputs = 0;
+
+/* State of the last reading sent, which the filters compare against.
+ * REG_INPUTS_STATE can't be used since its read handler loads the live
+ * state of the pins. */
+static uint16_t last_processed_state = 0;
+
+/* The inputs in their dead time don't interrupt */
+static void inputs_int_masks_update(void)
+{
+	uint16_t unmasked = ((edges_rising | edges_falling) & ~inputs_locked) | output_inputs;
+	
+	PORTA_INT1MASK = unmasked & INPUTS_OF_PORTA_INT1;
+	PORTA_INT0MASK = unmasked & INPUTS_OF_PORTA_INT0;
+	PORTB_INT0MASK = (unmasked & INPUTS_OF_PORTB_INT0) >> 6;
+}
+
+static void inputs_int_config(void)
+{
+	uint16_t rising = edges_rising | output_inputs;
+	uint16_t falling = edges_falling | output_inputs;
+	uint16_t enabled = rising | falling;
+	
+	for (uint8_t i = 0; i < 9; i++)
+	{
+		register8_t *pinctrl = (i < 6) ? &PORTA.PIN0CTRL + i : &PORTB.PIN0CTRL + (i - 6);
+		uint16_t input = 1 << i;
+		uint8_t isc = PORT_ISC_BOTHEDGES_gc;
+		
+		if ((rising & input) && !(falling & input))
+			isc = PORT_ISC_FALLING_gc;
+		else if ((falling & input) && !(rising & input))
+			isc = PORT_ISC_RISING_gc;
+		
+		*pinctrl = (*pinctrl & ~PORT_ISC_gm) | isc;
+	}
+	
+	uint8_t level = app_regs.REG_INPUTS_INT_LEVEL;
+	
+	PORTA_INTCTRL = (enabled & INPUTS_OF_PORTA_INT1 ? level << 2 : PORT_INT1LVL_OFF_gc) | (enabled & INPUTS_OF_PORTA_INT0 ? level : PORT_INT0LVL_OFF_gc);
+	PORTB_INTCTRL = (enabled & INPUTS_OF_PORTB_INT0 ? level : PORT_INT0LVL_OFF_gc);
+	
+	inputs_int_masks_update();
+}
+
+/* The hardware pulse of DO0 only restarts on the enabled edges of DI0 */
+static uint8_t pulse_hw_event_action(void)
+{
+	return ((edges_rising | edges_falling) & B_INPUT0) ? TC_EVACT_RESTART_gc | TC_EVSEL_CH0_gc : TC_EVACT_OFF_gc;
+}
+
+static void inputs_edges_config(uint16_t rising, uint16_t falling)
+{
+	edges_rising = rising & MSK_INPUTS;
+	edges_falling = falling & MSK_INPUTS;
+	inputs_int_config();
+	
+	if ((app_regs.REG_OUTPUT_MODE & MSK_OUTPUT_MODE) == GM_OUTMODE_PULSE_HW)
+		TCC0_CTRLD = pulse_hw_event_action();
+}
+
+static void output_inputs_config(void)
+{
+	switch (app_regs.REG_OUTPUT_MODE & MSK_OUTPUT_MODE)
+	{
+		case GM_OUTMODE_LOGIC:
+			output_inputs = app_regs.REG_LOGIC_MASK | app_regs.REG_LOGIC_RESET_MASK;
+			break;
+		
+		case GM_OUTMODE_TRIGGER:
+			output_inputs = app_regs.REG_TRIGGER_RISING_EDGE | app_regs.REG_TRIGGER_FALLING_EDGE;
+			break;
+		
+		case GM_OUTMODE_PATTERN:
+			output_inputs = app_regs.REG_PATTERN_TRIGGER;
+			break;
+		
+		default:
+			output_inputs = 0;
+	}
+	
+	output_inputs &= MSK_INPUTS;
+	inputs_int_config();
+}
+
+/* Returns the inputs with an enabled edge since the last reading. The
+ * sources are the inputs served by the interrupt that latched it. */
+static uint16_t inputs_edges_detected(uint16_t digital_inputs, uint16_t sources, uint16_t ignored)
+{
+	uint16_t previous = last_processed_state;
+	uint16_t both = edges_rising & edges_falling;
+	uint16_t single = edges_rising ^ edges_falling;
+	uint16_t changed = (digital_inputs ^ previous) & (both | single) & ~ignored;
+	uint16_t at_level = (digital_inputs & edges_rising) | (~digital_inputs & edges_falling);
+	uint16_t edges = changed & (both | at_level);
+	
+	/* The inputs catched on a single edge don't interrupt on the other one,
+	 * so they may return to their previous state unnoticed. If none of the
+	 * inputs of the interrupt changed, the edge was one of those. */
+	if (!(changed & sources))
+		edges |= sources & single & at_level & ~ignored;
+	
+	return edges;
+}
+
+
+/************************************************************************/
+/* Dead time                                                            */
+/************************************************************************/
+/* After a change is catched, the interrupt of the input is masked until
+ * its dead time ends, so its bounces don't interrupt nor take queue slots.
+ * The time is measured with TCD0. A dead time during which the input was
+ * seen changing counts as one glitch. */
+static uint16_t inputs_lock_start[9];
+static uint16_t inputs_glitched = 0;
+
+static void dead_time_reset(void)
+{
+	inputs_locked = 0;
+	inputs_glitched = 0;
+	inputs_int_masks_update();
+}
+
+static void dead_time_lock(uint16_t inputs, uint16_t now)
+{
+	uint16_t lock = 0;
+	
+	for (uint8_t i = 0; i < 9; i++)
+	{
+		if ((inputs & (1 << i)) && app_regs.REG_INPUTS_DEAD_TIME[i])
+		{
+			inputs_lock_start[i] = now;
+			lock |= (1 << i);
+		}
+	}
+	
+	/* The input interrupts read the locks and the masks */
+	uint8_t sreg = SREG;
+	cli();
+	inputs_locked |= lock;
+	inputs_int_masks_update();
+	SREG = sreg;
+}
+
+/* Counts a glitch for each input that changed during its dead time */
+static void dead_time_count_glitches(uint16_t inputs)
+{
+	for (uint8_t i = 0; i < 9; i++)
+		if ((inputs & (1 << i)) && app_regs.REG_INPUTS_GLITCHES[i] != 0xFFFF)
+			app_regs.REG_INPUTS_GLITCHES[i]++;
+}
+
+/* Replaces the locked inputs with their previous state */
+static uint16_t dead_time_filter(uint16_t digital_inputs)
+{
+	inputs_glitched |= (digital_inputs ^ last_processed_state) & inputs_locked;
+	
+	return (digital_inputs & ~inputs_locked) | (last_processed_state & inputs_locked);
+}
+
+
+/************************************************************************/
+/* Edge counters                                                        */
+/************************************************************************/
+/* TCD0 overflows are counted to extend it to 32 bits (2 us per tick) */
+static volatile uint16_t time_base_high = 0;
+static uint32_t inputs_last_edge[9];
+static uint16_t inputs_last_edge_valid = 0;
+
+static uint32_t time_base_ticks(void)
+{
+	uint16_t high = time_base_high;
+	uint16_t low = TCD0_CNT;
+	
+	/* The overflow interrupt may still be pending */
+	if ((TCD0_INTFLAGS & TC0_OVFIF_bm) && low < 0x8000)
+		high++;
+	
+	return ((uint32_t)high << 16) | low;
+}
+
+static void edge_counters_reset_periods(void)
+{
+	inputs_last_edge_valid = 0;
+}
+
+/* Counts the edges and measures the periods between the edges of the same direction */
+static void edge_counters_update(uint16_t edges, uint16_t digital_inputs, uint32_t now)
+{
+
+	for (uint8_t i = 0; i < 9; i++)
+	{
+		uint16_t input = 1 << i;
+		
+		if (!(edges & input))
+			continue;
+		
+		app_regs.REG_INPUTS_EDGE_COUNT[i]++;
+		
+		/* The period is measured on the rising edges unless only the falling edge is catched */
+		if ((edges_rising & input) ? (digital_inputs & input) : !(digital_inputs & input))
+		{
+			/* Saturates at 2^32 us, about 71.6 minutes */
+			if (inputs_last_edge_valid & input)
+				app_regs.REG_INPUTS_PERIOD[i] = (now - inputs_last_edge[i] >= 0x80000000) ? 0xFFFFFFFF : (now - inputs_last_edge[i]) << 1;
+			
+			inputs_last_edge[i] = now;
+			inputs_last_edge_valid |= input;
+		}
+	}
+}
+
+
+/************************************************************************/
+/* Hardware capture                                                     */
+/************************************************************************/
+/* INPUT0 to INPUT3 are captured by TCD0 (event channels 0 to 3) and
+ * INPUT4 to INPUT7 by TCE0 (event channels 4 to 7). Both timers run
+ * freely at 2 us per tick. INPUT8 doesn't have an event channel left and
+ * is timestamped when the interrupt is serviced. */
+#define TIMESTAMP_USECONDS_PER_SECOND 31250		// R_TIMESTAMP_MICRO counts 32 us
+
+static void capture_start(void)
+{
+	TCE0_CTRLA = TC_CLKSEL_OFF_gc;
+	
+	/* TCD0 is also the time base, so it isn't stopped or cleared and its
+	 * overflow flag is kept */
+	TCD0_CTRLB = TC0_CCAEN_bm | TC0_CCBEN_bm | TC0_CCCEN_bm | TC0_CCDEN_bm;
+	TCD0_CTRLD = TC_EVACT_CAPT_gc | TC_EVSEL_CH0_gc;
+	TCD0_PER = 0xFFFF;
+	TCD0_INTFLAGS = TC0_CCAIF_bm | TC0_CCBIF_bm | TC0_CCCIF_bm | TC0_CCDIF_bm;
+	TCD0_INTCTRLA = app_regs.REG_INPUTS_INT_LEVEL;
+	TCD0_CTRLA = TC_CLKSEL_DIV64_gc;
+	
+	TCE0_CTRLB = TC0_CCAEN_bm | TC0_CCBEN_bm | TC0_CCCEN_bm | TC0_CCDEN_bm;
+	TCE0_CTRLD = TC_EVACT_CAPT_gc | TC_EVSEL_CH4_gc;
+	TCE0_PER = 0xFFFF;
+	TCE0_CNT = 0;
+	TCE0_INTFLAGS = 0xFF;
+	TCE0_CTRLA = TC_CLKSEL_DIV64_gc;
+}
+
+static void capture_stop(void)
+{
+	TCE0_CTRLA = TC_CLKSEL_OFF_gc;
+	TCD0_CTRLB = 0;
+	TCE0_CTRLB = 0;
+	TCD0_CTRLD = 0;
+	TCE0_CTRLD = 0;
+	
+	/* TCD0 keeps running as the time base of the dead time and periods */
+	TCD0_PER = 0xFFFF;
+	TCD0_INTCTRLA = app_regs.REG_INPUTS_INT_LEVEL;
+	TCD0_CTRLA = TC_CLKSEL_DIV64_gc;
+}
+
+/* Discards the pending captures of the inputs */
+static void capture_flush(uint16_t inputs)
+{
+	register16_t* cc = &TCD0.CCA;
+	
+	for (uint8_t i = 0; i < 8; i++, cc++)
+	{
+		if (i == 4)
+			cc = &TCE0.CCA;
+		
+		if (inputs & (1 << i))
+		{
+			/* The captures are double buffered */
+			*cc;
+			*cc;
+		}
+	}
+}
+
+/* Returns the number of ticks elapsed since the oldest pending capture */
+static uint16_t capture_oldest_edge_age(TC0_t* timer, uint8_t channels)
+{
+	uint16_t now = timer->CNT;
+	uint16_t age = 0;
+	register16_t* cc = &timer->CCA;
+	
+	for (uint8_t flag = TC0_CCAIF_bm; flag; flag <<= 1, channels >>= 1, cc++)
+	{
+		/* Reading the CCx register clears the flag */
+		if ((channels & 1) && (timer->INTFLAGS & flag))
+		{
+			uint16_t edge_age = now - *cc;
+			
+			if (edge_age > age)
+				age = edge_age;
+		}
+	}
+	
+	return age;
+}
+
+/* Subtracts a number of timer ticks (2 us) from a harp timestamp */
+static void timestamp_subtract_ticks(uint32_t *second, uint16_t *usecond, uint16_t ticks)
+{
+	uint16_t age = (uint16_t)(((uint32_t)ticks + 8) >> 4);
+	
+	if (*usecond >= age)
+	{
+		*usecond -= age;
+	}
+	else
+	{
+		*usecond += TIMESTAMP_USECONDS_PER_SECOND - age;
+		*second -= 1;
+	}
+}
+
+/* The interrupts keep their own timestamp, so the user timestamp of the
+ * core is only used by the main loop to send the events */
+static uint32_t latch_second;
+static uint16_t latch_usecond;
+
+static void latch_read_timestamp(void)
+{
+	uint16_t usecond;
+	
+	/* The second may be updated between the reads when R_TIMESTAMP_MICRO wraps */
+	do
+	{
+		usecond = core_func_read_R_TIMESTAMP_MICRO();
+		latch_second = core_func_read_R_TIMESTAMP_SECOND();
+		latch_usecond = core_func_read_R_TIMESTAMP_MICRO();
+	} while (latch_usecond < usecond);
+}
+
+/* Loads the latch timestamp with the time of the edge being serviced */
+static void latch_capture_timestamp(void)
+{
+	uint16_t ticks_d, ticks_e;
+	uint16_t enabled;
+	
+	latch_read_timestamp();
+	/* Disabled and locked inputs still capture */
+	enabled = (edges_rising | edges_falling) & ~inputs_locked;
+	ticks_d = capture_oldest_edge_age(&TCD0, enabled & 0x0F);
+	ticks_e = capture_oldest_edge_age(&TCE0, (enabled >> 4) & 0x0F);
+	if (ticks_e > ticks_d)
+		ticks_d = ticks_e;
+	
+	timestamp_subtract_ticks(&latch_second, &latch_usecond, ticks_d);
+	
+	/* The age of the edge is the latency of its interrupt */
+	if (ticks_d > (app_regs.REG_CAPTURE_LATENCY_MAX >> 1))
+		app_regs.REG_CAPTURE_LATENCY_MAX = (ticks_d < 0x8000) ? ticks_d << 1 : 0xFFFF;
+}
+
+
+/************************************************************************/
+/* Sampling timer                                                       */
+/************************************************************************/
+/* TCD1 runs at 0.25 us per tick, so periods up to 16383 us are exact */
+#define SAMPLING_PERIOD_MIN 100
+#define SAMPLING_PERIOD_MAX 16383
+
+static void sampling_timer_start(uint16_t period)
+{
+	TCD1_CTRLA = TC_CLKSEL_OFF_gc;
+	TCD1_CTRLB = TC_WGMODE_NORMAL_gc;
+	TCD1_PER = (period << 2) - 1;
+	TCD1_CNT = 0;
+	TCD1_INTFLAGS = 0xFF;
+	TCD1_INTCTRLA = app_regs.REG_INPUTS_INT_LEVEL;
+	TCD1_CTRLA = TC_CLKSEL_DIV8_gc;
+}
+
+static void sampling_timer_stop(void)
+{
+	TCD1_CTRLA = TC_CLKSEL_OFF_gc;
+	TCD1_INTCTRLA = TC_OVFINTLVL_OFF_gc;
+}
+
+/* Returns the sample period of the fixed-rate catch modes in microseconds */
+static uint16_t samples_without_event = 0;
+
+static uint16_t sample_period(uint8_t catch_mode)
+{
+	switch (catch_mode)
+	{
+		case GM_INMODE_1000Hz_BATCH:
+			return 1000;
+		
+		case GM_INMODE_2000Hz_BATCH:
+			return 500;
+		
+		default:
+			return app_regs.REG_SAMPLING_PERIOD;
+	}
+}
+
+
+/************************************************************************/
+/* DO0 hardware pulse                                                   */
+/************************************************************************/
+/* TCC0 is restarted by the event channel 0 (INPUT0's edges) and the
+ * restart clears the compare output, which is inverted on OUTPUT0, so the
+ * pulse starts without the CPU. CCA is kept above PER, so the output is
+ * only set again on the overflow, ending the pulse. Widths up to 16383 us
+ * use 0.25 us per tick, longer ones 2 us per tick. */
+static void pulse_hw_stop(void)
+{
+	TCC0_CTRLA = TC_CLKSEL_OFF_gc;
+	TCC0_CTRLB = 0;
+	TCC0_CTRLD = 0;
+	TCC0_INTCTRLA = 0;
+	TCC0_INTCTRLB = 0;
+	PORTC_PIN0CTRL &= ~PORT_INVEN_bm;
+}
+
+static void pulse_hw_start(uint16_t width)
+{
+	pulse_hw_stop();
+	clr_OUTPUT0;
+	
+	TCC0_CTRLB = TC0_CCAEN_bm | TC_WGMODE_SS_gc;
+	TCC0_CTRLC = TC0_CMPA_bm;
+	TCC0_CTRLD = pulse_hw_event_action();
+	TCC0_PER = (width <= 16383) ? (width << 2) - 1 : (width >> 1) - 1;
+	TCC0_CCA = 0xFFFF;
+	TCC0_CNT = 0;
+	TCC0_INTFLAGS = 0xFF;
+	PORTC_PIN0CTRL |= PORT_INVEN_bm;
+	TCC0_CTRLA = (width <= 16383) ? TC_CLKSEL_DIV8_gc : TC_CLKSEL_DIV64_gc;
+}
+
+
+/************************************************************************/
+/* DO0 logic                                                            */
+/************************************************************************/
+/* The functions of the masked inputs are precomputed for the 512 states
+ * of the inputs, so the output is updated with a single lookup when the
+ * inputs are latched. The set-reset depends on its previous output and
+ * is evaluated directly. The table is rebuilt by the main loop after the
+ * registers it depends on are written, into the table not in use. */
+static uint8_t logic_tables[2][512 / 8];
+static uint8_t *logic_table = logic_tables[0];
+static volatile bool logic_table_dirty = false;
+static bool logic_set = false;
+
+static const uint8_t logic_nibble_count[16] = {0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4};
+
+static void logic_table_build(void)
+{
+	uint8_t *table = (logic_table == logic_tables[0]) ? logic_tables[1] : logic_tables[0];
+	uint16_t mask = app_regs.REG_LOGIC_MASK;
+	
+	for (uint16_t state = 0; state < 512; state++)
+	{
+		uint16_t high = state & mask;
+		uint8_t count = logic_nibble_count[high & 0x0F] + logic_nibble_count[(high >> 4) & 0x0F] + (high >> 8);
+		bool out;
+		
+		switch (app_regs.REG_LOGIC_FUNCTION & MSK_LOGIC_FUNCTION)
+		{
+			case GM_LOGIC_AND:
+				out = mask && (high == mask);
+				break;
+			case GM_LOGIC_OR:
+				out = count > 0;
+				break;
+			case GM_LOGIC_XOR:
+				out = count & 1;
+				break;
+			case GM_LOGIC_THRESHOLD:
+				out = count >= app_regs.REG_LOGIC_THRESHOLD;
+				break;
+			default:
+				out = false;
+		}
+		
+		if (out)
+			table[state >> 3] |= 1 << (state & 7);
+		else
+			table[state >> 3] &= ~(1 << (state & 7));
+	}
+	
+	/* The table is used by the interrupts */
+	uint8_t sreg = SREG;
+	cli();
+	logic_table = table;
+	SREG = sreg;
+}
+
+static void logic_update(uint16_t digital_inputs)
+{
+	bool out;
+	
+	if ((app_regs.REG_LOGIC_FUNCTION & MSK_LOGIC_FUNCTION) == GM_LOGIC_SET_RESET)
+	{
+		if (digital_inputs & app_regs.REG_LOGIC_RESET_MASK)
+			logic_set = false;
+		else if (digital_inputs & app_regs.REG_LOGIC_MASK)
+			logic_set = true;
+		
+		out = logic_set;
+	}
+	else
+	{
+		digital_inputs &= MSK_INPUTS;
+		out = logic_table[digital_inputs >> 3] & (1 << (digital_inputs & 7));
+	}
+	
+	if (out)
+	{
+		set_OUTPUT0;
+		if (core_bool_is_visual_enabled())
+			set_LEDOUT0;
+	}
+	else
+	{
+		clr_OUTPUT0;
+		clr_LEDOUT0;
+	}
+}
+
+
+/* Applies a new configuration to DO0 and to the interrupts it follows */
+static void logic_refresh(void)
+{
+	output_inputs_config();
+	
+	if ((app_regs.REG_OUTPUT_MODE & MSK_OUTPUT_MODE) != GM_OUTMODE_LOGIC)
+		return;
+	
+	uint8_t sreg = SREG;
+	cli();
+	
+	logic_update(read_inputs_state());
+	
+	SREG = sreg;
+}
+
+/* Rebuilds the table of DO0 after its registers were written */
+void logic_table_update(void)
+{
+	if (!logic_table_dirty)
+		return;
+	
+	logic_table_dirty = false;
+	logic_table_build();
+	logic_refresh();
+}
+
+
+/************************************************************************/
+/* DO0 trigger                                                          */
+/************************************************************************/
+/* The trigger is evaluated when the inputs are latched and restarts TCC0,
+ * which generates the delay and the pulse by hardware. The compare output
+ * is inverted on OUTPUT0, so the match of CCA raises the pin and the
+ * overflow ends the pulse. CCABUF loads CCA above PER on that overflow,
+ * so the timer keeps running without further matches. */
+static bool trigger_armed = false;
+static uint16_t trigger_inputs = 0;
+static uint16_t trigger_per;
+static uint16_t trigger_cca;
+static uint8_t trigger_clksel;
+
+static void trigger_config(void)
+{
+	uint16_t delay = app_regs.REG_TRIGGER_DELAY;
+	uint16_t width = app_regs.REG_PULSE_WIDTH;
+	uint16_t delay_ticks, width_ticks;
+	
+	if ((uint32_t)delay + width <= 16382)
+	{
+		trigger_clksel = TC_CLKSEL_DIV8_gc;
+		delay_ticks = delay << 2;
+		width_ticks = width << 2;
+	}
+	else
+	{
+		trigger_clksel = TC_CLKSEL_DIV64_gc;
+		delay_ticks = delay >> 1;
+		width_ticks = (width > 1) ? width >> 1 : 1;
+	}
+	
+	/* The interrupts fire the trigger */
+	uint8_t sreg = SREG;
+	cli();
+	
+	trigger_cca = delay_ticks + 1;
+	trigger_per = delay_ticks + width_ticks;
+	
+	pulse_hw_stop();
+	clr_OUTPUT0;
+	
+	TCC0_CTRLB = TC0_CCAEN_bm | TC_WGMODE_SS_gc;
+	TCC0_CTRLC = TC0_CMPA_bm;
+	TCC0_CCA = 0xFFFF;
+	TCC0_INTFLAGS = 0xFF;
+	PORTC_PIN0CTRL |= PORT_INVEN_bm;
+	
+	SREG = sreg;
+}
+
+static void trigger_fire(void)
+{
+	TCC0_CTRLA = TC_CLKSEL_OFF_gc;
+	TCC0_CTRLC = TC0_CMPA_bm;
+	TCC0_CNT = 0;
+	TCC0_PER = trigger_per;
+	TCC0_CCA = trigger_cca;
+	TCC0_CCABUF = 0xFFFF;
+	TCC0_CTRLA = trigger_clksel;
+}
+
+static void trigger_update(uint16_t digital_inputs)
+{
+	uint16_t rising = digital_inputs & ~trigger_inputs;
+	uint16_t falling = ~digital_inputs & trigger_inputs;
+	
+	trigger_inputs = digital_inputs;
+	
+	if (!trigger_armed)
+		return;
+	
+	if (!((rising & app_regs.REG_TRIGGER_RISING_EDGE) | (falling & app_regs.REG_TRIGGER_FALLING_EDGE)))
+		return;
+	
+	if ((digital_inputs ^ app_regs.REG_TRIGGER_PATTERN) & app_regs.REG_TRIGGER_PATTERN_MASK)
+		return;
+	
+	switch (app_regs.REG_TRIGGER_REARM_MODE & MSK_TRIGGER_REARM)
+	{
+		case GM_TRIGGER_REARM_AFTER_PULSE:
+			/* CCA is only above PER when the pulse is over */
+			if (TCC0_CCA != 0xFFFF)
+				return;
+			break;
+		
+		case GM_TRIGGER_REARM_MANUAL:
+			trigger_armed = false;
+			break;
+	}
+	
+	trigger_fire();
+}
+
+
+/************************************************************************/
+/* DO0 pattern                                                          */
+/************************************************************************/
+/* The durations alternate between high and low, starting high. TCC0 runs
+ * in frequency mode, so DO0 toggles on every match of CCA, and the DMA
+ * channel 0 loads CCABUF with the duration after the next one on each
+ * match. The first load is requested by software, so the transaction ends
+ * with the last high duration and its interrupt stops the timer during
+ * the last low duration. */
+#define PATTERN_DURATION_MAX 16383
+
+static uint16_t pattern_first;
+static uint16_t pattern_dma[32];
+static uint8_t pattern_length = 0;
+static uint16_t pattern_inputs = 0;
+static volatile bool pattern_playing = false;
+
+static void pattern_stop(void)
+{
+	uint8_t sreg = SREG;
+	cli();
+	
+	DMA_CH0_CTRLA = 0;
+	DMA_CH0_CTRLB = DMA_CH_TRNIF_bm | DMA_CH_ERRIF_bm;
+	
+	if (pattern_playing)
+	{
+		TCC0_CTRLA = TC_CLKSEL_OFF_gc;
+		TCC0_CTRLC = 0;
+		clr_LEDOUT0;
+		pattern_playing = false;
+	}
+	
+	SREG = sreg;
+}
+
+static void pattern_start(void)
+{
+	if (pattern_length == 0)
+		return;
+	
+	/* Also used by the interrupts */
+	uint8_t sreg = SREG;
+	cli();
+	
+	pattern_stop();
+	pulse_hw_stop();
+	clr_OUTPUT0;
+	
+	TCC0_CTRLB = TC0_CCAEN_bm | TC_WGMODE_FRQ_gc;
+	TCC0_CNT = 0;
+	TCC0_CCA = pattern_first;
+	TCC0_INTFLAGS = 0xFF;
+	
+	DMA_CTRL |= DMA_ENABLE_bm;
+	DMA_CH0_ADDRCTRL = DMA_CH_SRCRELOAD_BLOCK_gc | DMA_CH_SRCDIR_INC_gc | DMA_CH_DESTRELOAD_BURST_gc | DMA_CH_DESTDIR_INC_gc;
+	DMA_CH0_TRIGSRC = DMA_CH_TRIGSRC_TCC0_CCA_gc;
+	DMA_CH0_TRFCNT = pattern_length << 1;
+	DMA_CH0_REPCNT = app_regs.REG_PATTERN_REPEAT;
+	DMA_CH0_SRCADDR0 = (uint8_t)((uint16_t)(uintptr_t)pattern_dma);
+	DMA_CH0_SRCADDR1 = (uint8_t)((uint16_t)(uintptr_t)pattern_dma >> 8);
+	DMA_CH0_SRCADDR2 = 0;
+	DMA_CH0_DESTADDR0 = (uint8_t)((uint16_t)(uintptr_t)&TCC0_CCABUF);
+	DMA_CH0_DESTADDR1 = (uint8_t)((uint16_t)(uintptr_t)&TCC0_CCABUF >> 8);
+	DMA_CH0_DESTADDR2 = 0;
+	DMA_CH0_CTRLB = DMA_CH_TRNIF_bm | DMA_CH_ERRIF_bm | (app_regs.REG_PATTERN_REPEAT ? DMA_CH_TRNINTLVL_MED_gc : DMA_CH_TRNINTLVL_OFF_gc);
+	DMA_CH0_CTRLA = DMA_CH_ENABLE_bm | DMA_CH_REPEAT_bm | DMA_CH_SINGLE_bm | DMA_CH_BURSTLEN_2BYTE_gc;
+	
+	DMA_CH0_CTRLA |= DMA_CH_TRFREQ_bm;
+	while (DMA_CH0_CTRLB & (DMA_CH_CHBUSY_bm | DMA_CH_CHPEND_bm));
+	
+	pattern_playing = true;
+	if (core_bool_is_visual_enabled())
+		set_LEDOUT0;
+	
+	TCC0_CTRLC = TC0_CMPA_bm;
+	TCC0_CTRLA = TC_CLKSEL_DIV8_gc;
+	
+	SREG = sreg;
+}
+
+/* Converts the register to timer ticks, rotated by one for the DMA */
+static void pattern_load(void)
+{
+	uint8_t length = 0;
+	
+	while (length < 32 && app_regs.REG_PATTERN[length])
+		length++;
+	
+	for (uint8_t i = 0; i < length; i++)
+		pattern_dma[i] = (app_regs.REG_PATTERN[(i + 1) % length] << 2) - 1;
+	
+	pattern_first = (app_regs.REG_PATTERN[0] << 2) - 1;
+	pattern_length = length;
+}
+
+static void pattern_update(uint16_t digital_inputs)
+{
+	uint16_t rising = digital_inputs & ~pattern_inputs;
+	
+	pattern_inputs = digital_inputs;
+	
+	if ((rising & app_regs.REG_PATTERN_TRIGGER) && !pattern_playing)
+		pattern_start();
+}
+
+
+/************************************************************************/
+/* Telemetry                                                            */
+/************************************************************************/
+#define TELEMETRY_EVENTS_SENT 0
+#define TELEMETRY_READINGS_DROPPED 1
+#define TELEMETRY_READINGS_FILTERED 2
+#define TELEMETRY_LATENCY_MAX 3
+#define TELEMETRY_LATENCY_AVERAGE 4
+#define TELEMETRY_LATCH_CYCLES_MAX 5
+#define TELEMETRY_LATCH_CYCLES_AVERAGE 6
+#define TELEMETRY_LENGTH 7
+
+/* The latch duration is measured with TCD0, so its resolution is 64 cycles */
+#define TELEMETRY_CYCLES_PER_TICK 64
+
+static uint32_t telemetry_latency_sum = 0;
+static uint32_t telemetry_latency_count = 0;
+static uint32_t telemetry_latch_sum = 0;
+static uint32_t telemetry_latch_count = 0;
+
+void telemetry_reset(void)
+{
+	for (uint8_t i = 0; i < TELEMETRY_LENGTH; i++)
+		app_regs.REG_TELEMETRY[i] = 0;
+	
+	telemetry_latency_sum = 0;
+	telemetry_latency_count = 0;
+	telemetry_latch_sum = 0;
+	telemetry_latch_count = 0;
+}
+
+void telemetry_event_sent(void)
+{
+	app_regs.REG_TELEMETRY[TELEMETRY_EVENTS_SENT]++;
+}
+
+static void telemetry_latency(uint32_t ticks)
+{
+	uint32_t latency = ticks << 1;
+	
+	if (latency > app_regs.REG_TELEMETRY[TELEMETRY_LATENCY_MAX])
+		app_regs.REG_TELEMETRY[TELEMETRY_LATENCY_MAX] = latency;
+	
+	/* Keeps the average of the latest events when the sum grows too much */
+	if (telemetry_latency_sum > 0x7FFFFFFF)
+	{
+		telemetry_latency_sum >>= 1;
+		telemetry_latency_count >>= 1;
+	}
+	
+	telemetry_latency_sum += latency;
+	telemetry_latency_count++;
+}
+
+/* Called by the interrupts */
+static void telemetry_latch_cycles(uint16_t ticks)
+{
+	uint32_t cycles = (uint32_t)ticks * TELEMETRY_CYCLES_PER_TICK;
+	
+	if (cycles > app_regs.REG_TELEMETRY[TELEMETRY_LATCH_CYCLES_MAX])
+		app_regs.REG_TELEMETRY[TELEMETRY_LATCH_CYCLES_MAX] = cycles;
+	
+	if (telemetry_latch_sum > 0x7FFFFFFF)
+	{
+		telemetry_latch_sum >>= 1;
+		telemetry_latch_count >>= 1;
+	}
+	
+	telemetry_latch_sum += cycles;
+	telemetry_latch_count++;
+}
+
+/* Updates the values that are not counted as they happen */
+void telemetry_update(void)
+{
+	if (telemetry_latency_count)
+		app_regs.REG_TELEMETRY[TELEMETRY_LATENCY_AVERAGE] = telemetry_latency_sum / telemetry_latency_count;
+	
+	if (telemetry_latch_count)
+		app_regs.REG_TELEMETRY[TELEMETRY_LATCH_CYCLES_AVERAGE] = telemetry_latch_sum / telemetry_latch_count;
+}
+
+
 /************************************************************************/
 /* REG_INPUTS_STATE                                                     */
 /************************************************************************/
-void app_read_REG_INPUTS_STATE(void)
+/* Loads the register and the filters with the state of the pins */
+void inputs_state_reset(void)
+{
+	last_processed_state = read_inputs_state();
+	app_regs.REG_INPUTS_STATE = last_processed_state;
+}
+
+void app_read_REG_INPUTS_STATE(void)
+{
+	app_regs.REG_INPUTS_STATE = read_inputs_state();
+}
+
+bool app_write_REG_INPUTS_STATE(void *a)
+{
+	return false;
+}
+
+
+/************************************************************************/
+/* REG_OUTPUTS                                                          */
+/************************************************************************/
+void app_read_REG_OUTPUTS(void)
+{
+	app_regs.REG_OUTPUTS = read_OUTPUT0 ? 1 : 0;
+}
+
+bool app_write_REG_OUTPUTS(void *a)
+{
+	uint8_t reg = *((uint8_t*)a) & 1;
+
+	if (reg)
+	{
+		set_OUTPUT0;
+		set_LEDOUT0;
+	}
+	else
+	{
+		clr_OUTPUT0;
+		clr_LEDOUT0;
+	}
+
+	app_regs.REG_OUTPUTS = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_INPUT_CATCH_MODE                                                 */
+/************************************************************************/
+void app_read_REG_INPUT_CATCH_MODE(void)
+{
+	//app_regs.REG_INPUT_CATCH_MODE = 0;
+
+}
+
+bool app_write_REG_INPUT_CATCH_MODE(void *a)
+{
+	uint8_t reg = *((uint8_t*)a) & MSK_CATCH_MODE;
+
+	switch (reg)
+	{
+		case GM_INMODE_WHEN_ANY_CHANGE:
+		case GM_INMODE_HW_CAPTURE:
+				/* Enable the interrupts of the selected edges */
+				inputs_edges_config(app_regs.REG_INPUTS_RISING_EDGE, app_regs.REG_INPUTS_FALLING_EDGE);
+				break;
+		
+		case GM_INMODE_RISE_ON_INPUT0:
+				/* Enable only the interrupt of the Input 0 rising edge */
+				inputs_edges_config(B_INPUT0, 0);
+				break;
+
+		case GM_INMODE_FALL_ON_INPUT0:
+				/* Enable only the interrupt of the Input 0 falling edge */
+				inputs_edges_config(0, B_INPUT0);
+				break;
+
+		case GM_INMODE_DISABLED:
+		case GM_INMODE_100Hz:
+		case GM_INMODE_250Hz:
+		case GM_INMODE_500Hz:
+		case GM_INMODE_1000Hz:
+		case GM_INMODE_2000Hz:
+		case GM_INMODE_1000Hz_BATCH:
+		case GM_INMODE_2000Hz_BATCH:
+		case GM_INMODE_TIMER:
+		case GM_INMODE_TIMER_BATCH:
+				inputs_edges_config(0, 0);
+				break;
+				
+		default:
+				return false;				
+	}
+
+	if (reg == GM_INMODE_HW_CAPTURE)
+		capture_start();
+	else
+		capture_stop();
+
+	if (reg == GM_INMODE_TIMER || reg == GM_INMODE_TIMER_BATCH)
+		sampling_timer_start(app_regs.REG_SAMPLING_PERIOD);
+	else
+		sampling_timer_stop();
+
+	input_batch_reset(sample_period(reg));
+	samples_without_event = 0;
+	dead_time_reset();
+	edge_counters_reset_periods();
+
+	app_regs.REG_INPUT_CATCH_MODE = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_OUTPUT_MODE                                                      */
+/************************************************************************/
+void app_read_REG_OUTPUT_MODE(void)
+{
+	//app_regs.REG_OUTPUT_MODE = 0;
+
+}
+
+bool app_write_REG_OUTPUT_MODE(void *a)
+{
+	uint8_t reg = *((uint8_t*)a) & MSK_OUTPUT_MODE;
+   
+   uint16_t digital_inputs;
+
+	if (reg > GM_OUTMODE_PATTERN)
+		return false;
+	
+	pattern_stop();
+	pulse_hw_stop();
+
+	switch (reg)
+	{
+		case GM_OUTMODE_INPUT0:
+			if (read_INPUT0)
+			{
+				clr_OUTPUT0;
+				clr_LEDOUT0;
+			}
+			else
+			{
+				set_OUTPUT0;
+            if (core_bool_is_visual_enabled())
+				   set_LEDOUT0;
+			}
+			break;
+
+		case GM_OUTMODE_PULSE_250uS:
+		case GM_OUTMODE_PULSE_500uS:
+		case GM_OUTMODE_PULSE_1mS:
+		case GM_OUTMODE_PULSE_2mS:
+		case GM_OUTMODE_PULSE_5mS:
+			clr_OUTPUT0;
+			clr_LEDOUT0;
+			break;
+		
+		case GM_OUTMODE_PULSE_HW:
+			clr_LEDOUT0;
+			pulse_hw_start(app_regs.REG_PULSE_WIDTH);
+			break;
+		
+		case GM_OUTMODE_LOGIC:
+			logic_set = false;
+			logic_update(read_inputs_state());
+			break;
+		
+		case GM_OUTMODE_TRIGGER:
+			clr_LEDOUT0;
+			trigger_config();
+			trigger_inputs = read_inputs_state();
+			trigger_armed = true;
+			break;
+		
+		case GM_OUTMODE_PATTERN:
+			clr_OUTPUT0;
+			clr_LEDOUT0;
+			pattern_inputs = read_inputs_state();
+			break;
+      
+      case GM_OUTMODE_OR:
+         digital_inputs = read_inputs_state() & MSK_INPUTS;
+         
+         if (digital_inputs)
+         {
+            set_OUTPUT0;
+            if (core_bool_is_visual_enabled())
+               set_LEDOUT0;
+         }
+         else
+         {
+            clr_OUTPUT0;
+            clr_LEDOUT0;
+         }
+         
+         break;
+
+		case GM_OUTMODE_NOT_USED:
+		case GM_OUTMODE_TOGGLE:
+			break;
+
+		default:
+			return false;
+	}
+
+	app_regs.REG_OUTPUT_MODE = reg;
+	output_inputs_config();
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_RESERVED0                                                        */
+/************************************************************************/
+void app_read_REG_RESERVED0(void)
+{
+	//app_regs.REG_RESERVED0 = 0;
+}
+
+bool app_write_REG_RESERVED0(void *a)
+{
+	return false;
+}
+
+
+/************************************************************************/
+/* REG_RESERVED1                                                        */
+/************************************************************************/
+void app_read_REG_RESERVED1(void)
+{
+	//app_regs.REG_RESERVED1 = 0;
+}
+
+bool app_write_REG_RESERVED1(void *a)
+{	
+	return false;
+}
+
+
+/************************************************************************/
+/* REG_RESERVED2                                                        */
+/************************************************************************/
+void app_read_REG_RESERVED2(void)
+{
+	//app_regs.REG_RESERVED2 = 0;
+}
+
+bool app_write_REG_RESERVED2(void *a)
+{
+	return false;
+}
+
+
+/************************************************************************/
+/* REG_RESERVED3                                                        */
+/************************************************************************/
+void app_read_REG_RESERVED3(void)
+{
+	//app_regs.REG_RESERVED3 = 0;
+}
+
+bool app_write_REG_RESERVED3(void *a)
+{
+	return false;
+}
+
+
+/************************************************************************/
+/* REG_EVNT_ENABLE                                                      */
+/************************************************************************/
+void app_read_REG_EVNT_ENABLE(void)
+{
+	//app_regs.REG_EVNT_ENABLE = 0;
+}
+
+bool app_write_REG_EVNT_ENABLE(void *a)
+{
+	uint8_t reg = *((uint8_t*)a) & (B_EVT0 | B_EVT1 | B_EVT2);
+
+	app_regs.REG_EVNT_ENABLE = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_EVENT_QUEUE_OVERFLOWS                                            */
+/************************************************************************/
+void app_read_REG_EVENT_QUEUE_OVERFLOWS(void)
+{
+	//app_regs.REG_EVENT_QUEUE_OVERFLOWS = 0;
+}
+
+bool app_write_REG_EVENT_QUEUE_OVERFLOWS(void *a)
+{
+	return false;
+}
+
+
+/************************************************************************/
+/* REG_INPUTS_STATE_BATCH                                               */
+/************************************************************************/
+void app_read_REG_INPUTS_STATE_BATCH(void)
+{
+	//app_regs.REG_INPUTS_STATE_BATCH[0] = 0;
+}
+
+bool app_write_REG_INPUTS_STATE_BATCH(void *a)
+{
+	return false;
+}
+
+
+/************************************************************************/
+/* REG_SAMPLING_PERIOD                                                  */
+/************************************************************************/
+void app_read_REG_SAMPLING_PERIOD(void)
+{
+	//app_regs.REG_SAMPLING_PERIOD = 0;
+}
+
+bool app_write_REG_SAMPLING_PERIOD(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+	
+	if (reg < SAMPLING_PERIOD_MIN || reg > SAMPLING_PERIOD_MAX)
+		return false;
+
+	app_regs.REG_SAMPLING_PERIOD = reg;
+	
+	/* Restart the sampling with the new period */
+	app_write_REG_INPUT_CATCH_MODE(&app_regs.REG_INPUT_CATCH_MODE);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SAMPLING_EVENT_MODE                                              */
+/************************************************************************/
+void app_read_REG_SAMPLING_EVENT_MODE(void)
+{
+	//app_regs.REG_SAMPLING_EVENT_MODE = 0;
+}
+
+bool app_write_REG_SAMPLING_EVENT_MODE(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~MSK_SAMPLING_EVENT_MODE)
+		return false;
+
+	app_regs.REG_SAMPLING_EVENT_MODE = reg;
+	samples_without_event = 0;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_KEYFRAME_INTERVAL                                                */
+/************************************************************************/
+void app_read_REG_KEYFRAME_INTERVAL(void)
+{
+	//app_regs.REG_KEYFRAME_INTERVAL = 0;
+}
+
+bool app_write_REG_KEYFRAME_INTERVAL(void *a)
+{
+	app_regs.REG_KEYFRAME_INTERVAL = *((uint16_t*)a);
+	samples_without_event = 0;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_INPUTS_RISING_EDGE                                               */
+/************************************************************************/
+void app_read_REG_INPUTS_RISING_EDGE(void)
+{
+	//app_regs.REG_INPUTS_RISING_EDGE = 0;
+}
+
+bool app_write_REG_INPUTS_RISING_EDGE(void *a)
+{
+	app_regs.REG_INPUTS_RISING_EDGE = *((uint16_t*)a) & MSK_INPUTS;
+	
+	app_write_REG_INPUT_CATCH_MODE(&app_regs.REG_INPUT_CATCH_MODE);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_INPUTS_FALLING_EDGE                                              */
+/************************************************************************/
+void app_read_REG_INPUTS_FALLING_EDGE(void)
+{
+	//app_regs.REG_INPUTS_FALLING_EDGE = 0;
+}
+
+bool app_write_REG_INPUTS_FALLING_EDGE(void *a)
+{
+	app_regs.REG_INPUTS_FALLING_EDGE = *((uint16_t*)a) & MSK_INPUTS;
+	
+	app_write_REG_INPUT_CATCH_MODE(&app_regs.REG_INPUT_CATCH_MODE);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_INPUTS_DEAD_TIME                                                 */
+/************************************************************************/
+void app_read_REG_INPUTS_DEAD_TIME(void)
+{
+	//app_regs.REG_INPUTS_DEAD_TIME[0] = 0;
+}
+
+bool app_write_REG_INPUTS_DEAD_TIME(void *a)
+{
+	uint16_t *reg = ((uint16_t*)a);
+	
+	for (uint8_t i = 0; i < 9; i++)
+		app_regs.REG_INPUTS_DEAD_TIME[i] = reg[i];
+	
+	dead_time_reset();
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_INPUTS_GLITCHES                                                  */
+/************************************************************************/
+void app_read_REG_INPUTS_GLITCHES(void)
+{
+	//app_regs.REG_INPUTS_GLITCHES[0] = 0;
+}
+
+bool app_write_REG_INPUTS_GLITCHES(void *a)
+{
+	return false;
+}
+
+
+/************************************************************************/
+/* REG_INPUTS_EDGE_COUNT                                                */
+/************************************************************************/
+void app_read_REG_INPUTS_EDGE_COUNT(void)
+{
+	//app_regs.REG_INPUTS_EDGE_COUNT[0] = 0;
+}
+
+bool app_write_REG_INPUTS_EDGE_COUNT(void *a)
+{
+	uint32_t *reg = ((uint32_t*)a);
+	
+	for (uint8_t i = 0; i < 9; i++)
+		app_regs.REG_INPUTS_EDGE_COUNT[i] = reg[i];
+	
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_INPUTS_PERIOD                                                    */
+/************************************************************************/
+void app_read_REG_INPUTS_PERIOD(void)
+{
+	//app_regs.REG_INPUTS_PERIOD[0] = 0;
+}
+
+bool app_write_REG_INPUTS_PERIOD(void *a)
+{
+	return false;
+}
+
+
+/************************************************************************/
+/* REG_EDGE_COUNT_EVENT_PERIOD                                          */
+/************************************************************************/
+void app_read_REG_EDGE_COUNT_EVENT_PERIOD(void)
+{
+	//app_regs.REG_EDGE_COUNT_EVENT_PERIOD = 0;
+}
+
+bool app_write_REG_EDGE_COUNT_EVENT_PERIOD(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+	
+	if (reg == 0)
+		return false;
+
+	app_regs.REG_EDGE_COUNT_EVENT_PERIOD = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_PULSE_WIDTH                                                      */
+/************************************************************************/
+void app_read_REG_PULSE_WIDTH(void)
+{
+	//app_regs.REG_PULSE_WIDTH = 0;
+}
+
+bool app_write_REG_PULSE_WIDTH(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+	
+	if (reg == 0)
+		return false;
+
+	app_regs.REG_PULSE_WIDTH = reg;
+	
+	if ((app_regs.REG_OUTPUT_MODE & MSK_OUTPUT_MODE) == GM_OUTMODE_PULSE_HW)
+		pulse_hw_start(reg);
+	if ((app_regs.REG_OUTPUT_MODE & MSK_OUTPUT_MODE) == GM_OUTMODE_TRIGGER)
+		trigger_config();
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_LOGIC_MASK                                                       */
+/************************************************************************/
+void app_read_REG_LOGIC_MASK(void)
+{
+	//app_regs.REG_LOGIC_MASK = 0;
+}
+
+bool app_write_REG_LOGIC_MASK(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+
+	app_regs.REG_LOGIC_MASK = reg & MSK_INPUTS;
+	logic_table_dirty = true;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_LOGIC_FUNCTION                                                   */
+/************************************************************************/
+void app_read_REG_LOGIC_FUNCTION(void)
+{
+	//app_regs.REG_LOGIC_FUNCTION = 0;
+}
+
+bool app_write_REG_LOGIC_FUNCTION(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg > GM_LOGIC_SET_RESET)
+		return false;
+
+	app_regs.REG_LOGIC_FUNCTION = reg;
+	logic_set = false;
+	logic_table_dirty = true;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_LOGIC_THRESHOLD                                                  */
+/************************************************************************/
+void app_read_REG_LOGIC_THRESHOLD(void)
+{
+	//app_regs.REG_LOGIC_THRESHOLD = 0;
+}
+
+bool app_write_REG_LOGIC_THRESHOLD(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg > 9)
+		return false;
+
+	app_regs.REG_LOGIC_THRESHOLD = reg;
+	logic_table_dirty = true;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_LOGIC_RESET_MASK                                                 */
+/************************************************************************/
+void app_read_REG_LOGIC_RESET_MASK(void)
+{
+	//app_regs.REG_LOGIC_RESET_MASK = 0;
+}
+
+bool app_write_REG_LOGIC_RESET_MASK(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+
+	app_regs.REG_LOGIC_RESET_MASK = reg & MSK_INPUTS;
+	logic_refresh();
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_TRIGGER_RISING_EDGE                                              */
+/************************************************************************/
+void app_read_REG_TRIGGER_RISING_EDGE(void)
+{
+	//app_regs.REG_TRIGGER_RISING_EDGE = 0;
+}
+
+bool app_write_REG_TRIGGER_RISING_EDGE(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+
+	app_regs.REG_TRIGGER_RISING_EDGE = reg & MSK_INPUTS;
+	output_inputs_config();
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_TRIGGER_FALLING_EDGE                                             */
+/************************************************************************/
+void app_read_REG_TRIGGER_FALLING_EDGE(void)
+{
+	//app_regs.REG_TRIGGER_FALLING_EDGE = 0;
+}
+
+bool app_write_REG_TRIGGER_FALLING_EDGE(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+
+	app_regs.REG_TRIGGER_FALLING_EDGE = reg & MSK_INPUTS;
+	output_inputs_config();
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_TRIGGER_PATTERN_MASK                                             */
+/************************************************************************/
+void app_read_REG_TRIGGER_PATTERN_MASK(void)
 {
-	app_regs.REG_INPUTS_STATE = ((~PORTA_IN) & 0x3F) | (((~PORTB_IN) & 0x7) << 6) | (PORTC_IN & 0x01 ? 0x2000 : 0) | (PORTA_IN & 0x80 ? 0x4000 : 0) | (PORTC_IN & 0x02 ? 0x8000 : 0);
+	//app_regs.REG_TRIGGER_PATTERN_MASK = 0;
 }
 
-bool app_write_REG_INPUTS_STATE(void *a)
+bool app_write_REG_TRIGGER_PATTERN_MASK(void *a)
 {
-	return false;
+	uint16_t reg = *((uint16_t*)a);
+
+	app_regs.REG_TRIGGER_PATTERN_MASK = reg & MSK_INPUTS;
+	return true;
 }
 
 
 /************************************************************************/
-/* REG_OUTPUTS                                                          */
+/* REG_TRIGGER_PATTERN                                                  */
 /************************************************************************/
-void app_read_REG_OUTPUTS(void)
+void app_read_REG_TRIGGER_PATTERN(void)
 {
-	app_regs.REG_OUTPUTS = read_OUTPUT0 ? 1 : 0;
+	//app_regs.REG_TRIGGER_PATTERN = 0;
 }
 
-bool app_write_REG_OUTPUTS(void *a)
+bool app_write_REG_TRIGGER_PATTERN(void *a)
 {
-	uint8_t reg = *((uint8_t*)a) & 1;
-
-	if (reg)
-	{
-		set_OUTPUT0;
-		set_LEDOUT0;
-	}
-	else
-	{
-		clr_OUTPUT0;
-		clr_LEDOUT0;
-	}
+	uint16_t reg = *((uint16_t*)a);
 
-	app_regs.REG_OUTPUTS = reg;
+	app_regs.REG_TRIGGER_PATTERN = reg & MSK_INPUTS;
 	return true;
 }
 
 
 /************************************************************************/
-/* REG_INPUT_CATCH_MODE                                                 */
+/* REG_TRIGGER_DELAY                                                    */
 /************************************************************************/
-void app_read_REG_INPUT_CATCH_MODE(void)
+void app_read_REG_TRIGGER_DELAY(void)
 {
-	//app_regs.REG_INPUT_CATCH_MODE = 0;
-
+	//app_regs.REG_TRIGGER_DELAY = 0;
 }
 
-bool app_write_REG_INPUT_CATCH_MODE(void *a)
+bool app_write_REG_TRIGGER_DELAY(void *a)
 {
-	uint8_t reg = *((uint8_t*)a) & MSK_CATCH_MODE;
+	uint16_t reg = *((uint16_t*)a);
 
-	switch (reg)
-	{
-		case GM_INMODE_WHEN_ANY_CHANGE:
-				/* Enable all interrupts */
-				io_set_int(&PORTA, INT_LEVEL_LOW, 1, (1<<0), false);                 // INPUT0
-				io_set_int(&PORTA, INT_LEVEL_LOW, 0, (1<<1), false);                 // INPUT1
-				io_set_int(&PORTA, INT_LEVEL_LOW, 0, (1<<2), false);                 // INPUT2
-				io_set_int(&PORTA, INT_LEVEL_LOW, 0, (1<<3), false);                 // INPUT3
-				io_set_int(&PORTA, INT_LEVEL_LOW, 0, (1<<4), false);                 // INPUT4
-				io_set_int(&PORTA, INT_LEVEL_LOW, 0, (1<<5), false);                 // INPUT5
-				io_set_int(&PORTB, INT_LEVEL_LOW, 0, (1<<0), false);                 // INPUT6
-				io_set_int(&PORTB, INT_LEVEL_LOW, 0, (1<<1), false);                 // INPUT7
-				io_set_int(&PORTB, INT_LEVEL_LOW, 0, (1<<2), false);						// INPUT8
-				break;
-		
-		case GM_INMODE_RISE_ON_INPUT0:
-		case GM_INMODE_FALL_ON_INPUT0:
-				/* Enable only interrupts on Input 0*/
-				io_set_int(&PORTA, INT_LEVEL_LOW, 1, (1<<0), false);						// INPUT0
-				io_set_int(&PORTA, INT_LEVEL_OFF, 0, (1<<1), false);                 // INPUT1
-				io_set_int(&PORTB, INT_LEVEL_OFF, 0, (1<<0), false);                 // INPUT6
-				break;
+	app_regs.REG_TRIGGER_DELAY = reg;
+	
+	if ((app_regs.REG_OUTPUT_MODE & MSK_OUTPUT_MODE) == GM_OUTMODE_TRIGGER)
+		trigger_config();
+	return true;
+}
 
-		case GM_INMODE_DISABLED:
-		case GM_INMODE_100Hz:
-		case GM_INMODE_250Hz:
-		case GM_INMODE_500Hz:
-		case GM_INMODE_1000Hz:
-		case GM_INMODE_2000Hz:
-				io_set_int(&PORTA, INT_LEVEL_OFF, 1, (1<<0), false);                 // INPUT0
-				io_set_int(&PORTA, INT_LEVEL_OFF, 0, (1<<1), false);                 // INPUT1
-				io_set_int(&PORTB, INT_LEVEL_OFF, 0, (1<<0), false);                 // INPUT6
-				break;
-				
-		default:
-				return false;				
-	}
 
-	app_regs.REG_INPUT_CATCH_MODE = reg;
+/************************************************************************/
+/* REG_TRIGGER_REARM_MODE                                               */
+/************************************************************************/
+void app_read_REG_TRIGGER_REARM_MODE(void)
+{
+	//app_regs.REG_TRIGGER_REARM_MODE = 0;
+}
+
+bool app_write_REG_TRIGGER_REARM_MODE(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg > GM_TRIGGER_REARM_MANUAL)
+		return false;
+
+	app_regs.REG_TRIGGER_REARM_MODE = reg;
 	return true;
 }
 
 
 /************************************************************************/
-/* REG_OUTPUT_MODE                                                      */
+/* REG_TRIGGER_ARM                                                      */
 /************************************************************************/
-void app_read_REG_OUTPUT_MODE(void)
+void app_read_REG_TRIGGER_ARM(void)
 {
-	//app_regs.REG_OUTPUT_MODE = 0;
-
+	app_regs.REG_TRIGGER_ARM = trigger_armed ? 1 : 0;
 }
 
-bool app_write_REG_OUTPUT_MODE(void *a)
+bool app_write_REG_TRIGGER_ARM(void *a)
 {
-	uint8_t reg = *((uint8_t*)a) & MSK_OUTPUT_MODE;
-   
-   uint16_t digital_inputs;
+	uint8_t reg = *((uint8_t*)a);
 
-	switch (reg)
-	{
-		case GM_OUTMODE_INPUT0:
-			if (read_INPUT0)
-			{
-				clr_OUTPUT0;
-				clr_LEDOUT0;
-			}
-			else
-			{
-				set_OUTPUT0;
-            if (core_bool_is_visual_enabled())
-				   set_LEDOUT0;
-			}
-			break;
+	trigger_armed = reg & 1;
+	app_regs.REG_TRIGGER_ARM = reg & 1;
+	return true;
+}
 
-		case GM_OUTMODE_PULSE_250uS:
-		case GM_OUTMODE_PULSE_500uS:
-		case GM_OUTMODE_PULSE_1mS:
-		case GM_OUTMODE_PULSE_2mS:
-		case GM_OUTMODE_PULSE_5mS:
-			clr_OUTPUT0;
-			clr_LEDOUT0;
-			break;
-      
-      case GM_OUTMODE_OR:
-         digital_inputs = ((~PORTA_IN) & 0x3F) | (((~PORTB_IN) & 0x7) << 6);
-         
-         if (digital_inputs)
-         {
-            set_OUTPUT0;
-            if (core_bool_is_visual_enabled())
-               set_LEDOUT0;
-         }
-         else
-         {
-            clr_OUTPUT0;
-            clr_LEDOUT0;
-         }
-         
-         break;
 
-		case GM_OUTMODE_NOT_USED:
-		case GM_OUTMODE_TOGGLE:
-			break;
+/************************************************************************/
+/* REG_PATTERN                                                          */
+/************************************************************************/
+void app_read_REG_PATTERN(void)
+{
+	//app_regs.REG_PATTERN[0] = 0;
+}
 
-		default:
+bool app_write_REG_PATTERN(void *a)
+{
+	uint16_t *reg = ((uint16_t*)a);
+	uint8_t length = 0;
+	
+	while (length < 32 && reg[length])
+	{
+		if (reg[length] > PATTERN_DURATION_MAX)
 			return false;
+		length++;
 	}
+	
+	/* The durations go in high and low pairs */
+	if (length & 1)
+		return false;
+	
+	for (uint8_t i = 0; i < 32; i++)
+		app_regs.REG_PATTERN[i] = (i < length) ? reg[i] : 0;
+	
+	if (pattern_playing)
+		pattern_stop();
+	pattern_load();
+	return true;
+}
 
-	app_regs.REG_OUTPUT_MODE = reg;
+
+/************************************************************************/
+/* REG_PATTERN_REPEAT                                                   */
+/************************************************************************/
+void app_read_REG_PATTERN_REPEAT(void)
+{
+	//app_regs.REG_PATTERN_REPEAT = 0;
+}
+
+bool app_write_REG_PATTERN_REPEAT(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+
+	app_regs.REG_PATTERN_REPEAT = reg;
 	return true;
 }
 
 
 /************************************************************************/
-/* REG_RESERVED0                                                        */
+/* REG_PATTERN_TRIGGER                                                  */
 /************************************************************************/
-void app_read_REG_RESERVED0(void)
+void app_read_REG_PATTERN_TRIGGER(void)
 {
-	//app_regs.REG_RESERVED0 = 0;
+	//app_regs.REG_PATTERN_TRIGGER = 0;
 }
 
-bool app_write_REG_RESERVED0(void *a)
+bool app_write_REG_PATTERN_TRIGGER(void *a)
 {
-	return false;
+	uint16_t reg = *((uint16_t*)a);
+
+	app_regs.REG_PATTERN_TRIGGER = reg & MSK_INPUTS;
+	output_inputs_config();
+	return true;
 }
 
 
 /************************************************************************/
-/* REG_RESERVED1                                                        */
+/* REG_PATTERN_CONTROL                                                  */
 /************************************************************************/
-void app_read_REG_RESERVED1(void)
+void app_read_REG_PATTERN_CONTROL(void)
 {
-	//app_regs.REG_RESERVED1 = 0;
+	app_regs.REG_PATTERN_CONTROL = pattern_playing ? 1 : 0;
 }
 
-bool app_write_REG_RESERVED1(void *a)
-{	
-	return false;
+bool app_write_REG_PATTERN_CONTROL(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if ((app_regs.REG_OUTPUT_MODE & MSK_OUTPUT_MODE) != GM_OUTMODE_PATTERN)
+		return false;
+	
+	if (reg & 1)
+		pattern_start();
+	else
+		pattern_stop();
+	
+	app_regs.REG_PATTERN_CONTROL = reg & 1;
+	return true;
 }
 
 
 /************************************************************************/
-/* REG_RESERVED2                                                        */
+/* REG_INPUTS_INT_LEVEL                                                 */
 /************************************************************************/
-void app_read_REG_RESERVED2(void)
+void app_read_REG_INPUTS_INT_LEVEL(void)
 {
-	//app_regs.REG_RESERVED2 = 0;
+	//app_regs.REG_INPUTS_INT_LEVEL = 0;
 }
 
-bool app_write_REG_RESERVED2(void *a)
+bool app_write_REG_INPUTS_INT_LEVEL(void *a)
 {
-	return false;
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg < INT_LEVEL_LOW || reg > INT_LEVEL_HIGH)
+		return false;
+
+	app_regs.REG_INPUTS_INT_LEVEL = reg;
+	
+	/* Reconfigure the interrupts with the new level */
+	app_write_REG_INPUT_CATCH_MODE(&app_regs.REG_INPUT_CATCH_MODE);
+	return true;
 }
 
 
 /************************************************************************/
-/* REG_RESERVED3                                                        */
+/* REG_CAPTURE_LATENCY_MAX                                              */
 /************************************************************************/
-void app_read_REG_RESERVED3(void)
+void app_read_REG_CAPTURE_LATENCY_MAX(void)
 {
-	//app_regs.REG_RESERVED3 = 0;
+	//app_regs.REG_CAPTURE_LATENCY_MAX = 0;
 }
 
-bool app_write_REG_RESERVED3(void *a)
+bool app_write_REG_CAPTURE_LATENCY_MAX(void *a)
 {
-	return false;
+	/* Any write clears the measurement */
+	app_regs.REG_CAPTURE_LATENCY_MAX = 0;
+	return true;
 }
 
 
 /************************************************************************/
-/* REG_EVNT_ENABLE                                                      */
+/* REG_TELEMETRY                                                        */
 /************************************************************************/
-void app_read_REG_EVNT_ENABLE(void)
+void app_read_REG_TELEMETRY(void)
 {
-	//app_regs.REG_EVNT_ENABLE = 0;
+	telemetry_update();
 }
 
-bool app_write_REG_EVNT_ENABLE(void *a)
+bool app_write_REG_TELEMETRY(void *a)
 {
-	uint8_t reg = *((uint8_t*)a) & B_EVT0;
+	/* Any write clears the counters */
+	telemetry_reset();
+	return true;
+}
 
-	app_regs.REG_EVNT_ENABLE = reg;
+
+/************************************************************************/
+/* REG_TELEMETRY_EVENT_PERIOD                                           */
+/************************************************************************/
+void app_read_REG_TELEMETRY_EVENT_PERIOD(void)
+{
+	//app_regs.REG_TELEMETRY_EVENT_PERIOD = 0;
+}
+
+bool app_write_REG_TELEMETRY_EVENT_PERIOD(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+	
+	if (reg == 0)
+		return false;
+
+	app_regs.REG_TELEMETRY_EVENT_PERIOD = reg;
 	return true;
 }
 
@@ -277,22 +1854,148 @@ bool app_write_REG_EVNT_ENABLE(void *a)
 /************************************************************************/
 /* CATCH                                                                */
 /************************************************************************/
-void read(bool filter_equal_readings)
-{   
-    uint16_t digital_inputs = ((~PORTA_IN) & 0x3F) | (((~PORTB_IN) & 0x7) << 6) | (PORTC_IN & 0x01 ? 0x2000 : 0) | (PORTA_IN & 0x80 ? 0x4000 : 0) | (PORTC_IN & 0x02 ? 0x8000 : 0);
-    
-    if (filter_equal_readings)
-    {
-        if ((digital_inputs & 0x01FF) == (app_regs.REG_INPUTS_STATE & 0x01FF))
-            return;        
-    }
-    
-    app_regs.REG_INPUTS_STATE = digital_inputs;
+static void count_dropped_readings(uint8_t n)
+{
+	if (app_regs.REG_EVENT_QUEUE_OVERFLOWS > 0xFFFF - n)
+		app_regs.REG_EVENT_QUEUE_OVERFLOWS = 0xFFFF;
+	else
+		app_regs.REG_EVENT_QUEUE_OVERFLOWS += n;
+	
+	app_regs.REG_TELEMETRY[TELEMETRY_READINGS_DROPPED] += n;
+}
+
+/* The logic, the trigger and the pattern use the raw inputs to drive DO0 right away */
+static void output_follow_inputs(uint16_t digital_inputs)
+{
+	switch (app_regs.REG_OUTPUT_MODE & MSK_OUTPUT_MODE)
+	{
+		case GM_OUTMODE_LOGIC:
+			logic_update(digital_inputs);
+			break;
+		
+		case GM_OUTMODE_TRIGGER:
+			trigger_update(digital_inputs);
+			break;
+		
+		case GM_OUTMODE_PATTERN:
+			pattern_update(digital_inputs);
+			break;
+	}
+}
+
+/* Drives DO0 when the catch mode doesn't latch the inputs (called by the interrupts) */
+static void output_follow_pins(void)
+{
+	uint8_t sreg = SREG;
+	cli();
+	
+	output_follow_inputs(read_inputs_state());
+	
+	SREG = sreg;
+}
+
+/* Queues the state of the inputs and its timestamp (called by the interrupts) */
+void latch(uint8_t kind, uint16_t sources)
+{
+	input_reading_t reading;
+	
+	/* The inputs' interrupts may have a higher level than the caller */
+	uint8_t sreg = SREG;
+	cli();
+	
+	uint16_t start = TCD0_CNT;
+	reading.state = read_inputs_state();
+	reading.ticks = time_base_ticks();
+	reading.kind = kind;
+	reading.sources = sources;
+	
+	output_follow_inputs(reading.state);
+	
+	/* The capture mode already loaded the latch timestamp */
+	if ((app_regs.REG_INPUT_CATCH_MODE & MSK_CATCH_MODE) != GM_INMODE_HW_CAPTURE)
+		latch_read_timestamp();
+	
+	reading.second = latch_second;
+	reading.usecond = latch_usecond;
+	
+	if (!input_fifo_push(&reading))
+		count_dropped_readings(1);
+	
+	telemetry_latch_cycles(TCD0_CNT - start);
+	
+	SREG = sreg;
+}
+
+/* Returns false if the reading shouldn't be catched */
+static bool filter(input_reading_t *reading)
+{
+	switch (reading->kind)
+	{
+		case INPUT_READING_EDGE:
+		{
+			reading->state = dead_time_filter(reading->state);
+			uint16_t edges = inputs_edges_detected(reading->state, reading->sources, inputs_locked);
+			
+			if (!edges)
+				return false;
+			
+			dead_time_lock(edges, (uint16_t)reading->ticks);
+			edge_counters_update(edges, reading->state, reading->ticks);
+			return true;
+		}
+		
+		/* Counts the changes hidden by the dead times that just ended */
+		case INPUT_READING_FORCED:
+			edge_counters_update((reading->state ^ last_processed_state) & edges_rising & edges_falling & ~inputs_locked, reading->state, reading->ticks);
+			return true;
+		
+		case INPUT_READING_SAMPLE:
+			switch (app_regs.REG_INPUT_CATCH_MODE & MSK_CATCH_MODE)
+			{
+				case GM_INMODE_1000Hz_BATCH:
+				case GM_INMODE_2000Hz_BATCH:
+				case GM_INMODE_TIMER_BATCH:
+					return true;
+			}
+			
+			if ((app_regs.REG_SAMPLING_EVENT_MODE & MSK_SAMPLING_EVENT_MODE) == GM_SAMPLING_EVERY_SAMPLE)
+				return true;
+			
+			/* Send only the changes and a keyframe if none was sent for a while */
+			if (app_regs.REG_KEYFRAME_INTERVAL && ++samples_without_event >= app_regs.REG_KEYFRAME_INTERVAL)
+			{
+				samples_without_event = 0;
+				return true;
+			}
+			
+			if ((reading->state & 0x01FF) == (last_processed_state & 0x01FF))
+				return false;
+			
+			samples_without_event = 0;
+			return true;
+		
+		default:
+			return true;
+	}
+}
+
+/* Updates the LEDs and the output and sends the event (called by the main loop) */
+void process(input_reading_t *reading)
+{
+	if (!filter(reading))
+	{
+		app_regs.REG_TELEMETRY[TELEMETRY_READINGS_FILTERED]++;
+		return;
+	}
+	
+	uint16_t digital_inputs = reading->state;
+	
+	last_processed_state = digital_inputs;
+	app_regs.REG_INPUTS_STATE = digital_inputs;
 
 	if (core_bool_is_visual_enabled())
 	{        
-        PORTD_OUT = ~(*((uint8_t*)(&app_regs.REG_INPUTS_STATE)) & 0x3F);
-        PORTC_OUT = (PORTC_OUT & 0x8F) | ((~((uint8_t)(app_regs.REG_INPUTS_STATE >> 2))) & 0x70);
+        update_inputs_leds(digital_inputs);
 	}
 
 	switch (app_regs.REG_OUTPUT_MODE & MSK_OUTPUT_MODE)
@@ -304,7 +2007,7 @@ void read(bool filter_equal_readings)
 			break;
 
 		case GM_OUTMODE_INPUT0:
-			if (read_INPUT0)
+			if (!(digital_inputs & B_INPUT0))
 			{
 				clr_OUTPUT0;
 				clr_LEDOUT0;
@@ -365,7 +2068,71 @@ void read(bool filter_equal_readings)
 
 
 	if (app_regs.REG_EVNT_ENABLE & B_EVT0)
-		core_func_send_event(ADD_REG_INPUTS_STATE, true);
+	{
+		switch (app_regs.REG_INPUT_CATCH_MODE & MSK_CATCH_MODE)
+		{
+			case GM_INMODE_1000Hz_BATCH:
+			case GM_INMODE_2000Hz_BATCH:
+			case GM_INMODE_TIMER_BATCH:
+				if (!input_batch_add(digital_inputs, reading->second, reading->usecond))
+					count_dropped_readings(INPUT_BATCH_LENGTH);
+				break;
+			
+			default:
+			{
+				core_func_update_user_timestamp(reading->second, reading->usecond);
+				core_func_send_event(ADD_REG_INPUTS_STATE, false);
+				
+				/* The telemetry is also reset by the register writes */
+				uint8_t sreg = SREG;
+				cli();
+				
+				telemetry_event_sent();
+				telemetry_latency(time_base_ticks() - reading->ticks);
+				
+				SREG = sreg;
+			}
+		}
+	}
+}
+
+/* Ends the elapsed dead times and catches the changes they were hiding */
+void update_dead_time(void)
+{
+	if (!inputs_locked)
+		return;
+	
+	uint16_t now = TCD0_CNT;
+	uint16_t expired = 0;
+	
+	for (uint8_t i = 0; i < 9; i++)
+		if ((inputs_locked & (1 << i)) && (uint16_t)(now - inputs_lock_start[i]) >= ((app_regs.REG_INPUTS_DEAD_TIME[i] + 1) >> 1))
+			expired |= (1 << i);
+	
+	if (!expired)
+		return;
+	
+	uint8_t sreg = SREG;
+	cli();
+	
+	capture_flush(expired);
+	
+	uint16_t digital_inputs = read_inputs_state();
+	uint16_t hidden = (digital_inputs ^ last_processed_state) & expired;
+	
+	dead_time_count_glitches((inputs_glitched | hidden) & expired);
+	inputs_glitched &= ~expired;
+	inputs_locked &= ~expired;
+	inputs_int_masks_update();
+	
+	/* Only the inputs catched on both edges can have a hidden change */
+	if (hidden & edges_rising & edges_falling)
+	{
+		latch_read_timestamp();
+		latch(INPUT_READING_FORCED, 0);
+	}
+	
+	SREG = sreg;
 }
 
 
@@ -378,55 +2145,100 @@ ISR(TCC0_OVF_vect, ISR_NAKED)
 	reti();
 }
 
+/* Time base */
+ISR(TCD0_OVF_vect)
+{
+	time_base_high++;
+}
+
+/* Timer sampling */
+ISR(TCD1_OVF_vect)
+{
+	latch(INPUT_READING_SAMPLE, 0);
+}
+
 /* OUT0 Pulse */
-ISR(TCC0_CCA_vect, ISR_NAKED)
+ISR(TCC0_CCA_vect)
 {
 	timer_type0_stop(&TCC0);
 	clr_LEDOUT0;
+}
 
-	reti();
+/* OUT0 pattern's end */
+ISR(DMA_CH0_vect)
+{
+	pattern_stop();
 }
 
 /************************************************************************/
 /* INPUTS INTERRUPTS                                                    */
 /************************************************************************/
 /* Inputs 0 */
-ISR(PORTA_INT1_vect, ISR_NAKED)
+ISR(PORTA_INT1_vect)
 {
 	switch (app_regs.REG_INPUT_CATCH_MODE & MSK_CATCH_MODE)
 	{
 		case GM_INMODE_WHEN_ANY_CHANGE:
-			read(true);
-			break;
+			latch(INPUT_READING_EDGE, INPUTS_OF_PORTA_INT1);
+			return;
+
+		case GM_INMODE_HW_CAPTURE:
+			latch_capture_timestamp();
+			latch(INPUT_READING_EDGE, INPUTS_OF_PORTA_INT1);
+			return;
 
 		case GM_INMODE_RISE_ON_INPUT0:
 			if (!read_INPUT0)
-				read(true);
+			{
+				latch(INPUT_READING_EDGE, INPUTS_OF_PORTA_INT1);
+				return;
+			}
 			break;
 
 		case GM_INMODE_FALL_ON_INPUT0:
 			if (read_INPUT0)
-				read(true);
+			{
+				latch(INPUT_READING_EDGE, INPUTS_OF_PORTA_INT1);
+				return;
+			}
 			break;
 	}
-
-	reti();
+	
+	output_follow_pins();
 }
 
 /* Inputs 1 - 5 */
-ISR(PORTA_INT0_vect, ISR_NAKED)
+ISR(PORTA_INT0_vect)
 {	
-	if ((app_regs.REG_INPUT_CATCH_MODE & MSK_CATCH_MODE) == GM_INMODE_WHEN_ANY_CHANGE)
-		read(true);
+	switch (app_regs.REG_INPUT_CATCH_MODE & MSK_CATCH_MODE)
+	{
+		case GM_INMODE_WHEN_ANY_CHANGE:
+			latch(INPUT_READING_EDGE, INPUTS_OF_PORTA_INT0);
+			return;
 
-	reti();
+		case GM_INMODE_HW_CAPTURE:
+			latch_capture_timestamp();
+			latch(INPUT_READING_EDGE, INPUTS_OF_PORTA_INT0);
+			return;
+	}
+	
+	output_follow_pins();
 }
 
 /* Input 6 - 8 */
-ISR(PORTB_INT0_vect, ISR_NAKED)
+ISR(PORTB_INT0_vect)
 {
-	if ((app_regs.REG_INPUT_CATCH_MODE & MSK_CATCH_MODE) == GM_INMODE_WHEN_ANY_CHANGE)
-		read(true);
+	switch (app_regs.REG_INPUT_CATCH_MODE & MSK_CATCH_MODE)
+	{
+		case GM_INMODE_WHEN_ANY_CHANGE:
+			latch(INPUT_READING_EDGE, INPUTS_OF_PORTB_INT0);
+			return;
 
-	reti();
+		case GM_INMODE_HW_CAPTURE:
+			latch_capture_timestamp();
+			latch(INPUT_READING_EDGE, INPUTS_OF_PORTB_INT0);
+			return;
+	}
+	
+	output_follow_pins();
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #ifndef _APP_FUNCTIONS_H_
 #define _APP_FUNCTIONS_H_
 #include <avr/io.h>
+#include "input_fifo.h"
 
 
 /************************************************************************/
@@ -29,6 +30,38 @@ void app_read_REG_RESERVED1(void);
 void app_read_REG_RESERVED2(void);
 void app_read_REG_RESERVED3(void);
 void app_read_REG_EVNT_ENABLE(void);
+void app_read_REG_EVENT_QUEUE_OVERFLOWS(void);
+void app_read_REG_INPUTS_STATE_BATCH(void);
+void app_read_REG_SAMPLING_PERIOD(void);
+void app_read_REG_SAMPLING_EVENT_MODE(void);
+void app_read_REG_KEYFRAME_INTERVAL(void);
+void app_read_REG_INPUTS_RISING_EDGE(void);
+void app_read_REG_INPUTS_FALLING_EDGE(void);
+void app_read_REG_INPUTS_DEAD_TIME(void);
+void app_read_REG_INPUTS_GLITCHES(void);
+void app_read_REG_INPUTS_EDGE_COUNT(void);
+void app_read_REG_INPUTS_PERIOD(void);
+void app_read_REG_EDGE_COUNT_EVENT_PERIOD(void);
+void app_read_REG_PULSE_WIDTH(void);
+void app_read_REG_LOGIC_MASK(void);
+void app_read_REG_LOGIC_FUNCTION(void);
+void app_read_REG_LOGIC_THRESHOLD(void);
+void app_read_REG_LOGIC_RESET_MASK(void);
+void app_read_REG_TRIGGER_RISING_EDGE(void);
+void app_read_REG_TRIGGER_FALLING_EDGE(void);
+void app_read_REG_TRIGGER_PATTERN_MASK(void);
+void app_read_REG_TRIGGER_PATTERN(void);
+void app_read_REG_TRIGGER_DELAY(void);
+void app_read_REG_TRIGGER_REARM_MODE(void);
+void app_read_REG_TRIGGER_ARM(void);
+void app_read_REG_PATTERN(void);
+void app_read_REG_PATTERN_REPEAT(void);
+void app_read_REG_PATTERN_TRIGGER(void);
+void app_read_REG_PATTERN_CONTROL(void);
+void app_read_REG_INPUTS_INT_LEVEL(void);
+void app_read_REG_CAPTURE_LATENCY_MAX(void);
+void app_read_REG_TELEMETRY(void);
+void app_read_REG_TELEMETRY_EVENT_PERIOD(void);
 
 bool app_write_REG_INPUTS_STATE(void *a);
 bool app_write_REG_OUTPUTS(void *a);
@@ -39,6 +72,51 @@ bool app_write_REG_RESERVED1(void *a);
 bool app_write_REG_RESERVED2(void *a);
 bool app_write_REG_RESERVED3(void *a);
 bool app_write_REG_EVNT_ENABLE(void *a);
+bool app_write_REG_EVENT_QUEUE_OVERFLOWS(void *a);
+bool app_write_REG_INPUTS_STATE_BATCH(void *a);
+bool app_write_REG_SAMPLING_PERIOD(void *a);
+bool app_write_REG_SAMPLING_EVENT_MODE(void *a);
+bool app_write_REG_KEYFRAME_INTERVAL(void *a);
+bool app_write_REG_INPUTS_RISING_EDGE(void *a);
+bool app_write_REG_INPUTS_FALLING_EDGE(void *a);
+bool app_write_REG_INPUTS_DEAD_TIME(void *a);
+bool app_write_REG_INPUTS_GLITCHES(void *a);
+bool app_write_REG_INPUTS_EDGE_COUNT(void *a);
+bool app_write_REG_INPUTS_PERIOD(void *a);
+bool app_write_REG_EDGE_COUNT_EVENT_PERIOD(void *a);
+bool app_write_REG_PULSE_WIDTH(void *a);
+bool app_write_REG_LOGIC_MASK(void *a);
+bool app_write_REG_LOGIC_FUNCTION(void *a);
+bool app_write_REG_LOGIC_THRESHOLD(void *a);
+bool app_write_REG_LOGIC_RESET_MASK(void *a);
+bool app_write_REG_TRIGGER_RISING_EDGE(void *a);
+bool app_write_REG_TRIGGER_FALLING_EDGE(void *a);
+bool app_write_REG_TRIGGER_PATTERN_MASK(void *a);
+bool app_write_REG_TRIGGER_PATTERN(void *a);
+bool app_write_REG_TRIGGER_DELAY(void *a);
+bool app_write_REG_TRIGGER_REARM_MODE(void *a);
+bool app_write_REG_TRIGGER_ARM(void *a);
+bool app_write_REG_PATTERN(void *a);
+bool app_write_REG_PATTERN_REPEAT(void *a);
+bool app_write_REG_PATTERN_TRIGGER(void *a);
+bool app_write_REG_PATTERN_CONTROL(void *a);
+bool app_write_REG_INPUTS_INT_LEVEL(void *a);
+bool app_write_REG_CAPTURE_LATENCY_MAX(void *a);
+bool app_write_REG_TELEMETRY(void *a);
+bool app_write_REG_TELEMETRY_EVENT_PERIOD(void *a);
+
+
+/************************************************************************/
+/* Inputs' readings, called by the interrupts and the main loop         */
+/************************************************************************/
+void latch(uint8_t kind, uint16_t sources);
+void process(input_reading_t *reading);
+void update_dead_time(void);
+void inputs_state_reset(void);
+void logic_table_update(void);
+void telemetry_event_sent(void);
+void telemetry_update(void);
+void telemetry_reset(void);
 
 
 #endif /* _APP_FUNCTIONS_H_ */
\ No newline at end of file
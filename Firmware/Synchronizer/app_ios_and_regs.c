@@ -30,6 +30,20 @@ void init_ios(void)
 	io_set_int(&PORTB, INT_LEVEL_LOW, 0, (1<<1), false);                 // INPUT7
 	io_set_int(&PORTB, INT_LEVEL_LOW, 0, (1<<2), false);                 // INPUT8
 
+	/* Map the inputs' ports to the virtual ports */
+	PORTCFG_VPCTRLA = PORTCFG_VP02MAP_PORTA_gc | PORTCFG_VP13MAP_PORTB_gc;
+	PORTCFG_VPCTRLB = PORTCFG_VP02MAP_PORTC_gc | PORTCFG_VP13MAP_PORTD_gc;
+
+	/* Route inputs to the event system (used by the input capture) */
+	EVSYS_CH0MUX = EVSYS_CHMUX_PORTA_PIN0_gc;                             // INPUT0
+	EVSYS_CH1MUX = EVSYS_CHMUX_PORTA_PIN1_gc;                             // INPUT1
+	EVSYS_CH2MUX = EVSYS_CHMUX_PORTA_PIN2_gc;                             // INPUT2
+	EVSYS_CH3MUX = EVSYS_CHMUX_PORTA_PIN3_gc;                             // INPUT3
+	EVSYS_CH4MUX = EVSYS_CHMUX_PORTA_PIN4_gc;                             // INPUT4
+	EVSYS_CH5MUX = EVSYS_CHMUX_PORTA_PIN5_gc;                             // INPUT5
+	EVSYS_CH6MUX = EVSYS_CHMUX_PORTB_PIN0_gc;                             // INPUT6
+	EVSYS_CH7MUX = EVSYS_CHMUX_PORTB_PIN1_gc;                             // INPUT7
+
 	/* Configure output pins */
 	io_pin2out(&PORTD, 0, OUT_IO_DIGITAL, IN_EN_IO_DIS);                 // LEDIN0
 	io_pin2out(&PORTD, 1, OUT_IO_DIGITAL, IN_EN_IO_DIS);                 // LEDIN1
@@ -71,7 +85,39 @@ uint8_t app_regs_type[] = {
 	TYPE_U8,
 	TYPE_U8,
 	TYPE_U8,
-	TYPE_U8
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U32,
+	TYPE_U32,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U32,
+	TYPE_U16
 };
 
 uint16_t app_regs_n_elements[] = {
@@ -83,6 +129,38 @@ uint16_t app_regs_n_elements[] = {
 	1,
 	1,
 	1,
+	1,
+	1,
+	17,
+	1,
+	1,
+	1,
+	1,
+	1,
+	9,
+	9,
+	9,
+	9,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	32,
+	1,
+	1,
+	1,
+	1,
+	1,
+	7,
 	1
 };
 
@@ -95,5 +173,37 @@ uint8_t *app_regs_pointer[] = {
 	(uint8_t*)(&app_regs.REG_RESERVED1),
 	(uint8_t*)(&app_regs.REG_RESERVED2),
 	(uint8_t*)(&app_regs.REG_RESERVED3),
-	(uint8_t*)(&app_regs.REG_EVNT_ENABLE)
+	(uint8_t*)(&app_regs.REG_EVNT_ENABLE),
+	(uint8_t*)(&app_regs.REG_EVENT_QUEUE_OVERFLOWS),
+	(uint8_t*)(app_regs.REG_INPUTS_STATE_BATCH),
+	(uint8_t*)(&app_regs.REG_SAMPLING_PERIOD),
+	(uint8_t*)(&app_regs.REG_SAMPLING_EVENT_MODE),
+	(uint8_t*)(&app_regs.REG_KEYFRAME_INTERVAL),
+	(uint8_t*)(&app_regs.REG_INPUTS_RISING_EDGE),
+	(uint8_t*)(&app_regs.REG_INPUTS_FALLING_EDGE),
+	(uint8_t*)(app_regs.REG_INPUTS_DEAD_TIME),
+	(uint8_t*)(app_regs.REG_INPUTS_GLITCHES),
+	(uint8_t*)(app_regs.REG_INPUTS_EDGE_COUNT),
+	(uint8_t*)(app_regs.REG_INPUTS_PERIOD),
+	(uint8_t*)(&app_regs.REG_EDGE_COUNT_EVENT_PERIOD),
+	(uint8_t*)(&app_regs.REG_PULSE_WIDTH),
+	(uint8_t*)(&app_regs.REG_LOGIC_MASK),
+	(uint8_t*)(&app_regs.REG_LOGIC_FUNCTION),
+	(uint8_t*)(&app_regs.REG_LOGIC_THRESHOLD),
+	(uint8_t*)(&app_regs.REG_LOGIC_RESET_MASK),
+	(uint8_t*)(&app_regs.REG_TRIGGER_RISING_EDGE),
+	(uint8_t*)(&app_regs.REG_TRIGGER_FALLING_EDGE),
+	(uint8_t*)(&app_regs.REG_TRIGGER_PATTERN_MASK),
+	(uint8_t*)(&app_regs.REG_TRIGGER_PATTERN),
+	(uint8_t*)(&app_regs.REG_TRIGGER_DELAY),
+	(uint8_t*)(&app_regs.REG_TRIGGER_REARM_MODE),
+	(uint8_t*)(&app_regs.REG_TRIGGER_ARM),
+	(uint8_t*)(app_regs.REG_PATTERN),
+	(uint8_t*)(&app_regs.REG_PATTERN_REPEAT),
+	(uint8_t*)(&app_regs.REG_PATTERN_TRIGGER),
+	(uint8_t*)(&app_regs.REG_PATTERN_CONTROL),
+	(uint8_t*)(&app_regs.REG_INPUTS_INT_LEVEL),
+	(uint8_t*)(&app_regs.REG_CAPTURE_LATENCY_MAX),
+	(uint8_t*)(app_regs.REG_TELEMETRY),
+	(uint8_t*)(&app_regs.REG_TELEMETRY_EVENT_PERIOD)
 };
\ No newline at end of file
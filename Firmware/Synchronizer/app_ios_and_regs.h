@@ -109,7 +109,48 @@ void init_ios(void);
 #define set_OUTPUT0 set_io(PORTC, 0)
 #define clr_OUTPUT0 clear_io(PORTC, 0)
 #define tgl_OUTPUT0 toggle_io(PORTC, 0)
-#define read_OUTPUT0 read_io(PORTC, 0)
+#define read_OUTPUT0 (read_io(PORTC, 0) ^ ((PORTC_PIN0CTRL & PORT_INVEN_bm) >> 6))
+
+
+/************************************************************************/
+/* Inputs' state and LEDs                                               */
+/************************************************************************/
+/* INPUT0..5 are PA0..5 and INPUT6..8 are PB0..2 (inverted), OUTPUT0 is
+ * PC0 (inverted during the hardware pulse) and ADD0/ADD1 are PA7/PC1. PORTA..C are mapped to VPORT0..2 so the
+ * three ports are read in consecutive cycles. PORTA and PORTB are read
+ * again after PORTC and, if an input changed meanwhile, the snapshot is
+ * retaken, so the state always existed at the instant PORTC was read. */
+#define VPORT0_MSK_INPUTS 0xBF
+#define VPORT1_MSK_INPUTS 0x07
+#define READ_INPUTS_RETRIES 4
+
+static inline uint16_t read_inputs_state(void)
+{
+	uint8_t port_a, port_b, port_c;
+	uint8_t retries = READ_INPUTS_RETRIES;
+	
+	do
+	{
+		port_a = VPORT0_IN;
+		port_b = VPORT1_IN;
+		port_c = VPORT2_IN;
+	} while ((((port_a ^ VPORT0_IN) & VPORT0_MSK_INPUTS) | ((port_b ^ VPORT1_IN) & VPORT1_MSK_INPUTS)) && --retries);
+	
+	port_b = ~port_b;
+	port_c ^= (PORTC_PIN0CTRL & PORT_INVEN_bm) >> 6;
+	
+	uint8_t low = (~port_a & 0x3F) | (port_b << 6);
+	uint8_t high = ((port_b >> 2) & 0x01) | ((port_c & 0x01) << 5) | ((port_a & 0x80) >> 1) | ((port_c & 0x02) << 6);
+	
+	return ((uint16_t)high << 8) | low;
+}
+
+/* The LEDs are on when the pin is low */
+static inline void update_inputs_leds(uint16_t state)
+{
+	PORTD_OUT = (PORTD_OUT & 0xC0) | (~(uint8_t)state & 0x3F);
+	PORTC_OUT = (PORTC_OUT & 0x8F) | (~(uint8_t)(state >> 2) & 0x70);
+}
 
 
 /************************************************************************/
@@ -126,6 +167,38 @@ typedef struct
 	uint8_t REG_RESERVED2;
 	uint8_t REG_RESERVED3;
 	uint8_t REG_EVNT_ENABLE;
+	uint16_t REG_EVENT_QUEUE_OVERFLOWS;
+	uint16_t REG_INPUTS_STATE_BATCH[17];
+	uint16_t REG_SAMPLING_PERIOD;
+	uint8_t REG_SAMPLING_EVENT_MODE;
+	uint16_t REG_KEYFRAME_INTERVAL;
+	uint16_t REG_INPUTS_RISING_EDGE;
+	uint16_t REG_INPUTS_FALLING_EDGE;
+	uint16_t REG_INPUTS_DEAD_TIME[9];
+	uint16_t REG_INPUTS_GLITCHES[9];
+	uint32_t REG_INPUTS_EDGE_COUNT[9];
+	uint32_t REG_INPUTS_PERIOD[9];
+	uint16_t REG_EDGE_COUNT_EVENT_PERIOD;
+	uint16_t REG_PULSE_WIDTH;
+	uint16_t REG_LOGIC_MASK;
+	uint8_t REG_LOGIC_FUNCTION;
+	uint8_t REG_LOGIC_THRESHOLD;
+	uint16_t REG_LOGIC_RESET_MASK;
+	uint16_t REG_TRIGGER_RISING_EDGE;
+	uint16_t REG_TRIGGER_FALLING_EDGE;
+	uint16_t REG_TRIGGER_PATTERN_MASK;
+	uint16_t REG_TRIGGER_PATTERN;
+	uint16_t REG_TRIGGER_DELAY;
+	uint8_t REG_TRIGGER_REARM_MODE;
+	uint8_t REG_TRIGGER_ARM;
+	uint16_t REG_PATTERN[32];
+	uint8_t REG_PATTERN_REPEAT;
+	uint16_t REG_PATTERN_TRIGGER;
+	uint8_t REG_PATTERN_CONTROL;
+	uint8_t REG_INPUTS_INT_LEVEL;
+	uint16_t REG_CAPTURE_LATENCY_MAX;
+	uint32_t REG_TELEMETRY[7];
+	uint16_t REG_TELEMETRY_EVENT_PERIOD;
 } AppRegs;
 
 /************************************************************************/
@@ -141,6 +214,38 @@ typedef struct
 #define ADD_REG_RESERVED2                   38 // U8     Not used
 #define ADD_REG_RESERVED3                   39 // U8     Not used
 #define ADD_REG_EVNT_ENABLE                 40 // U8     Enable the Events
+#define ADD_REG_EVENT_QUEUE_OVERFLOWS       41 // U16    Number of input readings dropped because the events' queue was full
+#define ADD_REG_INPUTS_STATE_BATCH          42 // U16    Sample period in microseconds followed by consecutive readings of the inputs
+#define ADD_REG_SAMPLING_PERIOD             43 // U16    Sample period of the timer sampling modes in microseconds
+#define ADD_REG_SAMPLING_EVENT_MODE         44 // U8     Configures when the fixed-rate sampling modes send the events
+#define ADD_REG_KEYFRAME_INTERVAL           45 // U16    Maximum number of samples without an event when sending only the changes
+#define ADD_REG_INPUTS_RISING_EDGE          46 // U16    Inputs that are catched on the rising edge
+#define ADD_REG_INPUTS_FALLING_EDGE         47 // U16    Inputs that are catched on the falling edge
+#define ADD_REG_INPUTS_DEAD_TIME            48 // U16    Minimum time between two catched changes of each input in microseconds
+#define ADD_REG_INPUTS_GLITCHES             49 // U16    Number of changes of each input ignored during its dead time
+#define ADD_REG_INPUTS_EDGE_COUNT           50 // U32    Number of edges catched on each input
+#define ADD_REG_INPUTS_PERIOD               51 // U32    Time between the last two edges of the same direction of each input in microseconds
+#define ADD_REG_EDGE_COUNT_EVENT_PERIOD     52 // U16    Time between the events of register INPUTS_EDGE_COUNT in milliseconds
+#define ADD_REG_PULSE_WIDTH                 53 // U16    Width of the DO0 hardware pulse in microseconds
+#define ADD_REG_LOGIC_MASK                  54 // U16    Inputs used by the DO0 logic
+#define ADD_REG_LOGIC_FUNCTION              55 // U8     Function of the DO0 logic
+#define ADD_REG_LOGIC_THRESHOLD             56 // U8     Minimum number of high inputs of the DO0 threshold logic
+#define ADD_REG_LOGIC_RESET_MASK            57 // U16    Inputs that reset the DO0 set-reset logic
+#define ADD_REG_TRIGGER_RISING_EDGE         58 // U16    Inputs whose rising edge fires the DO0 trigger
+#define ADD_REG_TRIGGER_FALLING_EDGE        59 // U16    Inputs whose falling edge fires the DO0 trigger
+#define ADD_REG_TRIGGER_PATTERN_MASK        60 // U16    Inputs that must match TRIGGER_PATTERN
+#define ADD_REG_TRIGGER_PATTERN             61 // U16    State required on the inputs of TRIGGER_PATTERN_MASK
+#define ADD_REG_TRIGGER_DELAY               62 // U16    Delay of the DO0 trigger pulse in microseconds
+#define ADD_REG_TRIGGER_REARM_MODE          63 // U8     Re-arm policy of the DO0 trigger
+#define ADD_REG_TRIGGER_ARM                 64 // U8     Arms or disarms the DO0 trigger
+#define ADD_REG_PATTERN                     65 // U16    Durations of the DO0 pattern in microseconds
+#define ADD_REG_PATTERN_REPEAT              66 // U8     Number of times the DO0 pattern is played
+#define ADD_REG_PATTERN_TRIGGER             67 // U16    Inputs whose rising edge starts the DO0 pattern
+#define ADD_REG_PATTERN_CONTROL             68 // U8     Starts or stops the DO0 pattern
+#define ADD_REG_INPUTS_INT_LEVEL            69 // U8     Priority of the inputs' interrupts
+#define ADD_REG_CAPTURE_LATENCY_MAX         70 // U16    Worst case latency of the captured edges in microseconds
+#define ADD_REG_TELEMETRY                   71 // U32    Counters of the device's performance
+#define ADD_REG_TELEMETRY_EVENT_PERIOD      72 // U16    Period of the TELEMETRY events in milliseconds
 
 /************************************************************************/
 /* PWM Generator registers' memory limits                               */
@@ -150,8 +255,8 @@ typedef struct
 /************************************************************************/
 /* Memory limits */
 #define APP_REGS_ADD_MIN                    0x20
-#define APP_REGS_ADD_MAX                    0x28
-#define APP_NBYTES_OF_REG_BANK              10
+#define APP_REGS_ADD_MAX                    0x48
+#define APP_NBYTES_OF_REG_BANK              286
 
 /************************************************************************/
 /* Registers' bits                                                      */
@@ -181,6 +286,11 @@ typedef struct
 #define GM_INMODE_500Hz                    (6<<0)       // Catched at a frequency of 500 Hz
 #define GM_INMODE_1000Hz                   (7<<0)       // Catched at a frequency of 1 KHz
 #define GM_INMODE_2000Hz                   (8<<0)       // Catched at a frequency of 2 KHz
+#define GM_INMODE_HW_CAPTURE               (9<<0)       // Catched everytime one of the Inputs changes, timestamped by the timers' input capture
+#define GM_INMODE_1000Hz_BATCH             (10<<0)      // Catched at a frequency of 1 KHz and sent in batches
+#define GM_INMODE_2000Hz_BATCH             (11<<0)      // Catched at a frequency of 2 KHz and sent in batches
+#define GM_INMODE_TIMER                    (12<<0)      // Catched with the period of register SAMPLING_PERIOD
+#define GM_INMODE_TIMER_BATCH              (13<<0)      // Catched with the period of register SAMPLING_PERIOD and sent in batches
 #define MSK_OUTPUT_MODE                    (15<<0)      // Output mode
 #define GM_OUTMODE_NOT_USED                (0<<0)       // Not used by the catch
 #define GM_OUTMODE_TOGGLE                  (1<<0)       // Output toggles everytime the inputs are catched
@@ -191,6 +301,25 @@ typedef struct
 #define GM_OUTMODE_PULSE_500uS             (6<<0)       // Output has a positive pulse of 500 microseconds everytime the inputs are catched
 #define GM_OUTMODE_PULSE_250uS             (7<<0)       // Output has a positive pulse of 250 microseconds everytime the inputs are catched
 #define GM_OUTMODE_OR                      (8<<0)       // Logic OR of all the inputs
+#define GM_OUTMODE_PULSE_HW                (9<<0)       // Output has a positive pulse of PULSE_WIDTH microseconds, generated by hardware, on the enabled edges of Input 0
+#define GM_OUTMODE_LOGIC                   (10<<0)      // Output is the function LOGIC_FUNCTION of the inputs LOGIC_MASK
+#define GM_OUTMODE_TRIGGER                 (11<<0)      // Output has a positive pulse of PULSE_WIDTH microseconds, TRIGGER_DELAY microseconds after the trigger condition
+#define GM_OUTMODE_PATTERN                 (12<<0)      // Output plays the durations of register PATTERN
 #define B_EVT0                             (1<<0)       // Event of register INPUTS_STATE
+#define B_EVT1                             (1<<1)       // Event of register INPUTS_EDGE_COUNT
+#define B_EVT2                             (1<<2)       // Event of register TELEMETRY
+#define MSK_SAMPLING_EVENT_MODE            (1<<0)       // Sampling event mode
+#define GM_SAMPLING_EVERY_SAMPLE           (0<<0)       // An event is sent for every sample
+#define GM_SAMPLING_ON_CHANGE              (1<<0)       // An event is sent only when the inputs change or a keyframe is due
+#define MSK_LOGIC_FUNCTION                 (7<<0)       // Function of the DO0 logic
+#define GM_LOGIC_AND                       (0<<0)       // All the inputs of LOGIC_MASK are high
+#define GM_LOGIC_OR                        (1<<0)       // Any of the inputs of LOGIC_MASK is high
+#define GM_LOGIC_XOR                       (2<<0)       // An odd number of the inputs of LOGIC_MASK is high
+#define GM_LOGIC_THRESHOLD                 (3<<0)       // At least LOGIC_THRESHOLD of the inputs of LOGIC_MASK are high
+#define GM_LOGIC_SET_RESET                 (4<<0)       // Set by any input of LOGIC_MASK and reset by any input of LOGIC_RESET_MASK
+#define MSK_TRIGGER_REARM                  (3<<0)       // Re-arm policy of the DO0 trigger
+#define GM_TRIGGER_REARM_RETRIGGER         (0<<0)       // Every trigger restarts the delay and the pulse
+#define GM_TRIGGER_REARM_AFTER_PULSE       (1<<0)       // The triggers are ignored until the pulse ends
+#define GM_TRIGGER_REARM_MANUAL            (2<<0)       // Fires once and is re-armed through TRIGGER_ARM
 
 #endif /* _APP_REGS_H_ */
\ No newline at end of file
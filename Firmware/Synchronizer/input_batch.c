@@ -0,0 +1,80 @@
+#include <avr/interrupt.h>
+#include "input_batch.h"
+
+
+/************************************************************************/
+/* Input readings batch                                                 */
+/************************************************************************/
+/* While one batch is filled by the interrupts the other one waits to be
+ * sent by the main loop. */
+#define memory_barrier() __asm volatile("" ::: "memory")
+
+static input_batch_t batches[2];
+static uint8_t batch_index = 0;
+static uint8_t batch_filling = 0;
+static volatile bool batch_ready = false;
+
+void input_batch_reset(uint16_t period)
+{
+	uint8_t sreg = SREG;
+	cli();
+	
+	batch_index = 0;
+	batch_ready = false;
+	batches[0].period = period;
+	batches[1].period = period;
+	
+	SREG = sreg;
+}
+
+bool input_batch_add(uint16_t state, uint32_t second, uint16_t usecond)
+{
+	uint8_t sreg = SREG;
+	cli();
+	
+	input_batch_t *batch = &batches[batch_filling];
+	
+	if (batch_index == 0)
+	{
+		batch->second = second;
+		batch->usecond = usecond;
+	}
+	
+	batch->state[batch_index++] = state;
+	
+	if (batch_index < INPUT_BATCH_LENGTH)
+	{
+		SREG = sreg;
+		return true;
+	}
+	
+	batch_index = 0;
+	
+	/* The previous batch wasn't sent yet, so the new one is overwritten */
+	if (batch_ready)
+	{
+		SREG = sreg;
+		return false;
+	}
+	
+	memory_barrier();
+	batch_ready = true;
+	batch_filling ^= 1;
+	
+	SREG = sreg;
+	return true;
+}
+
+input_batch_t* input_batch_peek(void)
+{
+	if (!batch_ready)
+		return 0;
+	
+	return &batches[batch_filling ^ 1];
+}
+
+void input_batch_release(void)
+{
+	memory_barrier();
+	batch_ready = false;
+}
@@ -0,0 +1,49 @@
+#ifndef _INPUT_BATCH_H_
+#define _INPUT_BATCH_H_
+#include <avr/io.h>
+
+
+/************************************************************************/
+/* Define if not defined                                                */
+/************************************************************************/
+#ifndef bool
+	#define bool uint8_t
+#endif
+#ifndef true
+	#define true 1
+#endif
+#ifndef false
+	#define false 0
+#endif
+
+
+/************************************************************************/
+/* Input readings batch                                                 */
+/*                                                                      */
+/* Groups consecutive fixed-rate readings so they are sent in a single  */
+/* event with the timestamp of the first reading.                       */
+/************************************************************************/
+#define INPUT_BATCH_LENGTH 16
+
+typedef struct
+{
+	uint32_t second;
+	uint16_t usecond;
+	uint16_t period;		// Sample period in microseconds
+	uint16_t state[INPUT_BATCH_LENGTH];
+} input_batch_t;
+
+/* Discards any pending reading and sets the period of the next batches */
+void input_batch_reset(uint16_t period);
+
+/* Returns false if a complete batch had to be dropped */
+bool input_batch_add(uint16_t state, uint32_t second, uint16_t usecond);
+
+/* Returns the complete batch or 0 if there's none */
+input_batch_t* input_batch_peek(void);
+
+/* Frees the batch returned by input_batch_peek() */
+void input_batch_release(void);
+
+
+#endif /* _INPUT_BATCH_H_ */
@@ -0,0 +1,71 @@
+#include <avr/interrupt.h>
+#include "input_fifo.h"
+
+
+/************************************************************************/
+/* Input readings FIFO                                                  */
+/************************************************************************/
+/* The head is only written by the producers and the tail only by the
+ * consumer, so the main loop never needs to disable the interrupts. A
+ * flush only records the head and is applied by the consumer. */
+#define INPUT_FIFO_MASK (INPUT_FIFO_SIZE - 1)
+#define memory_barrier() __asm volatile("" ::: "memory")
+
+static input_reading_t fifo[INPUT_FIFO_SIZE];
+static volatile uint8_t fifo_head = 0;
+static volatile uint8_t fifo_tail = 0;
+static volatile uint8_t fifo_flush_head = 0;
+static volatile bool fifo_flush_pending = false;
+
+bool input_fifo_push(input_reading_t *reading)
+{
+	/* Readings come from interrupts with different levels */
+	uint8_t sreg = SREG;
+	cli();
+	
+	uint8_t head = fifo_head;
+	
+	if (((head + 1) & INPUT_FIFO_MASK) == fifo_tail)
+	{
+		SREG = sreg;
+		return false;
+	}
+	
+	fifo[head] = *reading;
+	
+	memory_barrier();
+	fifo_head = (head + 1) & INPUT_FIFO_MASK;
+	
+	SREG = sreg;
+	return true;
+}
+
+bool input_fifo_pop(input_reading_t *reading)
+{
+	uint8_t tail = fifo_tail;
+	
+	if (fifo_flush_pending)
+	{
+		fifo_flush_pending = false;
+		memory_barrier();
+		tail = fifo_flush_head;
+		fifo_tail = tail;
+	}
+	
+	if (tail == fifo_head)
+		return false;
+	
+	*reading = fifo[tail];
+	
+	memory_barrier();
+	fifo_tail = (tail + 1) & INPUT_FIFO_MASK;
+	
+	return true;
+}
+
+void input_fifo_flush(void)
+{
+	fifo_flush_head = fifo_head;
+	memory_barrier();
+	fifo_flush_pending = true;
+}
@@ -0,0 +1,52 @@
+#ifndef _INPUT_FIFO_H_
+#define _INPUT_FIFO_H_
+#include <avr/io.h>
+
+
+/************************************************************************/
+/* Define if not defined                                                */
+/************************************************************************/
+#ifndef bool
+	#define bool uint8_t
+#endif
+#ifndef true
+	#define true 1
+#endif
+#ifndef false
+	#define false 0
+#endif
+
+
+/************************************************************************/
+/* Input readings FIFO                                                  */
+/*                                                                      */
+/* Filled by the interrupts with each reading of the inputs and drained */
+/* by the main loop, which sends the events.                            */
+/************************************************************************/
+#define INPUT_FIFO_SIZE 32		// Must be a power of 2
+
+#define INPUT_READING_EDGE      0	// Catched by an input interrupt
+#define INPUT_READING_SAMPLE    1	// Catched by the fixed-rate sampling
+#define INPUT_READING_FORCED    2	// Always sent
+
+typedef struct
+{
+	uint16_t state;
+	uint32_t second;
+	uint16_t usecond;
+	uint32_t ticks;		// Time base ticks (2 us)
+	uint8_t kind;
+	uint16_t sources;	// Inputs served by the interrupt that latched the reading
+} input_reading_t;
+
+/* Returns false if the FIFO is full and the reading was dropped */
+bool input_fifo_push(input_reading_t *reading);
+
+/* Returns false if the FIFO is empty */
+bool input_fifo_pop(input_reading_t *reading);
+
+/* Drops the readings pushed so far when the FIFO is next popped */
+void input_fifo_flush(void);
+
+
+#endif /* _INPUT_FIFO_H_ */
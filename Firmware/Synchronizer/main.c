@@ -12,6 +12,6 @@ int main(void)
 	hwbp_app_enable_interrupts;
 	
 	/* Infinite loop */
-	while(1);
-		//__asm volatile("sleep");
+	while(1)
+		hwbp_app_dispatch_events();
 }
\ No newline at end of file
@@ -0,0 +1,12 @@
+/* Host stand-in for avr/interrupt.h. The interrupt service routines become
+ * plain functions, so the tests can call them to simulate an interrupt. */
+#ifndef _STUB_AVR_INTERRUPT_H_
+#define _STUB_AVR_INTERRUPT_H_
+
+#define ISR(vector, ...) void vector(void)
+#define ISR_NAKED
+#define reti()
+#define cli()
+#define sei()
+
+#endif /* _STUB_AVR_INTERRUPT_H_ */
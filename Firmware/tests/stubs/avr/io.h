@@ -0,0 +1,370 @@
+/* Host stand-in for the AVR XMEGA register definitions used by the
+ * application. The peripherals are plain variables defined in stubs.c. */
+#ifndef _STUB_AVR_IO_H_
+#define _STUB_AVR_IO_H_
+#include <stdint.h>
+#define __AVR_ATxmega32A4U__ 1
+typedef volatile uint8_t register8_t;
+typedef volatile uint16_t register16_t;
+typedef struct { register8_t DIR, DIRSET, DIRCLR, DIRTGL, OUT, OUTSET, OUTCLR, OUTTGL, IN, INTCTRL, INT0MASK, INT1MASK, INTFLAGS, r0, REMAP, r1, PIN0CTRL, PIN1CTRL, PIN2CTRL, PIN3CTRL, PIN4CTRL, PIN5CTRL, PIN6CTRL, PIN7CTRL; } PORT_t;
+typedef struct { register8_t DIR, OUT, IN, INTFLAGS; } VPORT_t;
+typedef struct { register8_t CTRLA, CTRLB, CTRLC, CTRLD, CTRLE, r0, INTCTRLA, INTCTRLB, CTRLFCLR, CTRLFSET, CTRLGCLR, CTRLGSET, INTFLAGS; register8_t r1[3]; register8_t TEMP; register16_t CNT, PER, CCA, CCB, CCC, CCD, PERBUF, CCABUF, CCBBUF, CCCBUF, CCDBUF; } TC0_t;
+typedef struct { register8_t CTRLA, CTRLB, CTRLC, CTRLD, CTRLE, r0, INTCTRLA, INTCTRLB, CTRLFCLR, CTRLFSET, CTRLGCLR, CTRLGSET, INTFLAGS; register8_t r1[3]; register8_t TEMP; register16_t CNT, PER, CCA, CCB, PERBUF, CCABUF, CCBBUF; } TC1_t;
+typedef struct { register8_t CH0MUX, CH1MUX, CH2MUX, CH3MUX, CH4MUX, CH5MUX, CH6MUX, CH7MUX, CH0CTRL, CH1CTRL, CH2CTRL, CH3CTRL, CH4CTRL, CH5CTRL, CH6CTRL, CH7CTRL, STROBE, DATA; } EVSYS_t;
+typedef struct { register8_t CTRLA, CTRLB, ADDRCTRL, TRIGSRC; register16_t TRFCNT; register8_t REPCNT, r0, SRCADDR0, SRCADDR1, SRCADDR2, r1, DESTADDR0, DESTADDR1, DESTADDR2, r2; } DMA_CH_t;
+typedef struct { register8_t CTRL, r0[2], INTFLAGS, STATUS, r1; register16_t TEMP; register8_t r2[8]; DMA_CH_t CH0, CH1, CH2, CH3; } DMA_t;
+typedef struct { register8_t STATUS, INTPRI, CTRL; } PMIC_t;
+typedef struct { register8_t CTRLA; } ADC_t;
+typedef struct { register8_t MPCMASK, r0[3], VPCTRLA, VPCTRLB, CLKEVOUT; } PORTCFG_t;
+extern PORT_t PORTA, PORTB, PORTC, PORTD, PORTE;
+extern VPORT_t VPORT0, VPORT1, VPORT2, VPORT3;
+extern TC0_t TCC0, TCD0, TCE0; extern TC1_t TCC1, TCD1;
+extern EVSYS_t EVSYS; extern DMA_t DMA; extern PMIC_t PMIC; extern PORTCFG_t PORTCFG;
+extern register8_t SREG;
+#define EVSYS_CH0MUX EVSYS.CH0MUX
+#define EVSYS_CH1MUX EVSYS.CH1MUX
+#define EVSYS_CH2MUX EVSYS.CH2MUX
+#define EVSYS_CH3MUX EVSYS.CH3MUX
+#define EVSYS_CH4MUX EVSYS.CH4MUX
+#define EVSYS_CH5MUX EVSYS.CH5MUX
+#define EVSYS_CH6MUX EVSYS.CH6MUX
+#define EVSYS_CH7MUX EVSYS.CH7MUX
+#define EVSYS_CH0CTRL EVSYS.CH0CTRL
+#define EVSYS_CH1CTRL EVSYS.CH1CTRL
+#define EVSYS_CH2CTRL EVSYS.CH2CTRL
+#define EVSYS_CH3CTRL EVSYS.CH3CTRL
+#define EVSYS_CH4CTRL EVSYS.CH4CTRL
+#define EVSYS_CH5CTRL EVSYS.CH5CTRL
+#define EVSYS_CH6CTRL EVSYS.CH6CTRL
+#define EVSYS_CH7CTRL EVSYS.CH7CTRL
+#define EVSYS_CHMUX_PORTA_PIN1_gc 0x51
+#define EVSYS_CHMUX_PORTA_PIN2_gc 0x52
+#define EVSYS_CHMUX_PORTA_PIN3_gc 0x53
+#define EVSYS_CHMUX_PORTA_PIN4_gc 0x54
+#define EVSYS_CHMUX_PORTA_PIN5_gc 0x55
+#define EVSYS_CHMUX_PORTB_PIN1_gc 0x59
+#define EVSYS_CHMUX_PORTB_PIN2_gc 0x5A
+#define TCC0_CTRLA TCC0.CTRLA
+#define TCC0_CTRLB TCC0.CTRLB
+#define TCC0_CTRLC TCC0.CTRLC
+#define TCC0_CTRLD TCC0.CTRLD
+#define TCC0_CTRLE TCC0.CTRLE
+#define TCC0_INTCTRLA TCC0.INTCTRLA
+#define TCC0_INTCTRLB TCC0.INTCTRLB
+#define TCC0_CTRLFCLR TCC0.CTRLFCLR
+#define TCC0_CTRLFSET TCC0.CTRLFSET
+#define TCC0_INTFLAGS TCC0.INTFLAGS
+#define TCC0_CNT TCC0.CNT
+#define TCC0_PER TCC0.PER
+#define TCC0_CCA TCC0.CCA
+#define TCC0_CCB TCC0.CCB
+#define TCC0_PERBUF TCC0.PERBUF
+#define TCC0_CCABUF TCC0.CCABUF
+#define TCC0_CCBBUF TCC0.CCBBUF
+#define TCC0_CCC TCC0.CCC
+#define TCC0_CCD TCC0.CCD
+#define TCD0_CTRLA TCD0.CTRLA
+#define TCD0_CTRLB TCD0.CTRLB
+#define TCD0_CTRLC TCD0.CTRLC
+#define TCD0_CTRLD TCD0.CTRLD
+#define TCD0_CTRLE TCD0.CTRLE
+#define TCD0_INTCTRLA TCD0.INTCTRLA
+#define TCD0_INTCTRLB TCD0.INTCTRLB
+#define TCD0_CTRLFCLR TCD0.CTRLFCLR
+#define TCD0_CTRLFSET TCD0.CTRLFSET
+#define TCD0_INTFLAGS TCD0.INTFLAGS
+#define TCD0_CNT TCD0.CNT
+#define TCD0_PER TCD0.PER
+#define TCD0_CCA TCD0.CCA
+#define TCD0_CCB TCD0.CCB
+#define TCD0_PERBUF TCD0.PERBUF
+#define TCD0_CCABUF TCD0.CCABUF
+#define TCD0_CCBBUF TCD0.CCBBUF
+#define TCD0_CCC TCD0.CCC
+#define TCD0_CCD TCD0.CCD
+#define TCE0_CTRLA TCE0.CTRLA
+#define TCE0_CTRLB TCE0.CTRLB
+#define TCE0_CTRLC TCE0.CTRLC
+#define TCE0_CTRLD TCE0.CTRLD
+#define TCE0_CTRLE TCE0.CTRLE
+#define TCE0_INTCTRLA TCE0.INTCTRLA
+#define TCE0_INTCTRLB TCE0.INTCTRLB
+#define TCE0_CTRLFCLR TCE0.CTRLFCLR
+#define TCE0_CTRLFSET TCE0.CTRLFSET
+#define TCE0_INTFLAGS TCE0.INTFLAGS
+#define TCE0_CNT TCE0.CNT
+#define TCE0_PER TCE0.PER
+#define TCE0_CCA TCE0.CCA
+#define TCE0_CCB TCE0.CCB
+#define TCE0_PERBUF TCE0.PERBUF
+#define TCE0_CCABUF TCE0.CCABUF
+#define TCE0_CCBBUF TCE0.CCBBUF
+#define TCE0_CCC TCE0.CCC
+#define TCE0_CCD TCE0.CCD
+#define TCC1_CTRLA TCC1.CTRLA
+#define TCC1_CTRLB TCC1.CTRLB
+#define TCC1_CTRLC TCC1.CTRLC
+#define TCC1_CTRLD TCC1.CTRLD
+#define TCC1_CTRLE TCC1.CTRLE
+#define TCC1_INTCTRLA TCC1.INTCTRLA
+#define TCC1_INTCTRLB TCC1.INTCTRLB
+#define TCC1_CTRLFCLR TCC1.CTRLFCLR
+#define TCC1_CTRLFSET TCC1.CTRLFSET
+#define TCC1_INTFLAGS TCC1.INTFLAGS
+#define TCC1_CNT TCC1.CNT
+#define TCC1_PER TCC1.PER
+#define TCC1_CCA TCC1.CCA
+#define TCC1_CCB TCC1.CCB
+#define TCC1_PERBUF TCC1.PERBUF
+#define TCC1_CCABUF TCC1.CCABUF
+#define TCC1_CCBBUF TCC1.CCBBUF
+#define TCD1_CTRLA TCD1.CTRLA
+#define TCD1_CTRLB TCD1.CTRLB
+#define TCD1_CTRLC TCD1.CTRLC
+#define TCD1_CTRLD TCD1.CTRLD
+#define TCD1_CTRLE TCD1.CTRLE
+#define TCD1_INTCTRLA TCD1.INTCTRLA
+#define TCD1_INTCTRLB TCD1.INTCTRLB
+#define TCD1_CTRLFCLR TCD1.CTRLFCLR
+#define TCD1_CTRLFSET TCD1.CTRLFSET
+#define TCD1_INTFLAGS TCD1.INTFLAGS
+#define TCD1_CNT TCD1.CNT
+#define TCD1_PER TCD1.PER
+#define TCD1_CCA TCD1.CCA
+#define TCD1_CCB TCD1.CCB
+#define TCD1_PERBUF TCD1.PERBUF
+#define TCD1_CCABUF TCD1.CCABUF
+#define TCD1_CCBBUF TCD1.CCBBUF
+#define PORTA_DIR PORTA.DIR
+#define PORTA_INTCTRL PORTA.INTCTRL
+#define PORTA_INT0MASK PORTA.INT0MASK
+#define PORTA_INT1MASK PORTA.INT1MASK
+#define PORTA_INTFLAGS PORTA.INTFLAGS
+#define PORTA_OUTSET PORTA.OUTSET
+#define PORTA_OUTCLR PORTA.OUTCLR
+#define PORTA_OUTTGL PORTA.OUTTGL
+#define PORTA_PIN0CTRL PORTA.PIN0CTRL
+#define PORTA_PIN1CTRL PORTA.PIN1CTRL
+#define PORTA_PIN2CTRL PORTA.PIN2CTRL
+#define PORTA_PIN3CTRL PORTA.PIN3CTRL
+#define PORTA_PIN4CTRL PORTA.PIN4CTRL
+#define PORTA_PIN5CTRL PORTA.PIN5CTRL
+#define PORTA_PIN6CTRL PORTA.PIN6CTRL
+#define PORTA_PIN7CTRL PORTA.PIN7CTRL
+#define PORTB_DIR PORTB.DIR
+#define PORTB_INTCTRL PORTB.INTCTRL
+#define PORTB_INT0MASK PORTB.INT0MASK
+#define PORTB_INT1MASK PORTB.INT1MASK
+#define PORTB_INTFLAGS PORTB.INTFLAGS
+#define PORTB_OUTSET PORTB.OUTSET
+#define PORTB_OUTCLR PORTB.OUTCLR
+#define PORTB_OUTTGL PORTB.OUTTGL
+#define PORTB_PIN0CTRL PORTB.PIN0CTRL
+#define PORTB_PIN1CTRL PORTB.PIN1CTRL
+#define PORTB_PIN2CTRL PORTB.PIN2CTRL
+#define PORTB_PIN3CTRL PORTB.PIN3CTRL
+#define PORTB_PIN4CTRL PORTB.PIN4CTRL
+#define PORTB_PIN5CTRL PORTB.PIN5CTRL
+#define PORTB_PIN6CTRL PORTB.PIN6CTRL
+#define PORTB_PIN7CTRL PORTB.PIN7CTRL
+#define PORTC_DIR PORTC.DIR
+#define PORTC_INTCTRL PORTC.INTCTRL
+#define PORTC_INT0MASK PORTC.INT0MASK
+#define PORTC_INT1MASK PORTC.INT1MASK
+#define PORTC_INTFLAGS PORTC.INTFLAGS
+#define PORTC_OUTSET PORTC.OUTSET
+#define PORTC_OUTCLR PORTC.OUTCLR
+#define PORTC_OUTTGL PORTC.OUTTGL
+#define PORTC_PIN0CTRL PORTC.PIN0CTRL
+#define PORTC_PIN1CTRL PORTC.PIN1CTRL
+#define PORTC_PIN2CTRL PORTC.PIN2CTRL
+#define PORTC_PIN3CTRL PORTC.PIN3CTRL
+#define PORTC_PIN4CTRL PORTC.PIN4CTRL
+#define PORTC_PIN5CTRL PORTC.PIN5CTRL
+#define PORTC_PIN6CTRL PORTC.PIN6CTRL
+#define PORTC_PIN7CTRL PORTC.PIN7CTRL
+#define PORTD_DIR PORTD.DIR
+#define PORTD_INTCTRL PORTD.INTCTRL
+#define PORTD_INT0MASK PORTD.INT0MASK
+#define PORTD_INT1MASK PORTD.INT1MASK
+#define PORTD_INTFLAGS PORTD.INTFLAGS
+#define PORTD_OUTSET PORTD.OUTSET
+#define PORTD_OUTCLR PORTD.OUTCLR
+#define PORTD_OUTTGL PORTD.OUTTGL
+#define PORTD_PIN0CTRL PORTD.PIN0CTRL
+#define PORTD_PIN1CTRL PORTD.PIN1CTRL
+#define PORTD_PIN2CTRL PORTD.PIN2CTRL
+#define PORTD_PIN3CTRL PORTD.PIN3CTRL
+#define PORTD_PIN4CTRL PORTD.PIN4CTRL
+#define PORTD_PIN5CTRL PORTD.PIN5CTRL
+#define PORTD_PIN6CTRL PORTD.PIN6CTRL
+#define PORTD_PIN7CTRL PORTD.PIN7CTRL
+#define PORTE_DIR PORTE.DIR
+#define PORTE_INTCTRL PORTE.INTCTRL
+#define PORTE_INT0MASK PORTE.INT0MASK
+#define PORTE_INT1MASK PORTE.INT1MASK
+#define PORTE_INTFLAGS PORTE.INTFLAGS
+#define PORTE_OUTSET PORTE.OUTSET
+#define PORTE_OUTCLR PORTE.OUTCLR
+#define PORTE_OUTTGL PORTE.OUTTGL
+#define PORTE_PIN0CTRL PORTE.PIN0CTRL
+#define PORTE_PIN1CTRL PORTE.PIN1CTRL
+#define PORTE_PIN2CTRL PORTE.PIN2CTRL
+#define PORTE_PIN3CTRL PORTE.PIN3CTRL
+#define PORTE_PIN4CTRL PORTE.PIN4CTRL
+#define PORTE_PIN5CTRL PORTE.PIN5CTRL
+#define PORTE_PIN6CTRL PORTE.PIN6CTRL
+#define PORTE_PIN7CTRL PORTE.PIN7CTRL
+#define PORTA_IN PORTA.IN
+#define PORTB_IN PORTB.IN
+#define PORTC_IN PORTC.IN
+#define PORTD_IN PORTD.IN
+#define PORTA_OUT PORTA.OUT
+#define PORTB_OUT PORTB.OUT
+#define PORTC_OUT PORTC.OUT
+#define PORTD_OUT PORTD.OUT
+/* The virtual port reads go through stubs.c so the tests can move the pins between reads */
+uint8_t stub_vport_in(VPORT_t *vport);
+#define VPORT0_IN stub_vport_in(&VPORT0)
+#define VPORT1_IN stub_vport_in(&VPORT1)
+#define VPORT2_IN stub_vport_in(&VPORT2)
+#define PMIC_CTRL PMIC.CTRL
+#define PMIC_RREN_bm 0x80
+#define PMIC_LOLVLEN_bm 1
+#define PMIC_MEDLVLEN_bm 2
+#define PMIC_HILVLEN_bm 4
+#define CPU_SREG SREG
+#define PORT_ISC_gm 0x07
+#define PORT_ISC_BOTHEDGES_gc 0
+#define PORT_ISC_RISING_gc 1
+#define PORT_ISC_FALLING_gc 2
+#define PORT_ISC_LEVEL_gc 3
+#define PORT_ISC_INPUT_DISABLE_gc 7
+#define PORT_INVEN_bm 0x40
+#define PORT_INT0LVL_gm 0x03
+#define PORT_INT1LVL_gm 0x0C
+#define PORT_INT0LVL_gp 0
+#define PORT_INT1LVL_gp 2
+#define PORT_INT0IF_bm 1
+#define PORT_INT1IF_bm 2
+#define EVSYS_CHMUX_PORTA_PIN0_gc 0x50
+#define EVSYS_CHMUX_PORTB_PIN0_gc 0x58
+#define EVSYS_CHMUX_TCD1_OVF_gc 0xE8
+#define EVSYS_DIGFILT_gm 0x07
+#define EVSYS_DIGFILT_1SAMPLE_gc 0
+#define TC_CLKSEL_gm 0x0F
+#define TC_CLKSEL_OFF_gc 0
+#define TC_CLKSEL_DIV1_gc 1
+#define TC_CLKSEL_DIV2_gc 2
+#define TC_CLKSEL_DIV4_gc 3
+#define TC_CLKSEL_DIV8_gc 4
+#define TC_CLKSEL_DIV64_gc 5
+#define TC_CLKSEL_DIV256_gc 6
+#define TC_CLKSEL_DIV1024_gc 7
+#define TC_CLKSEL_EVCH0_gc 8
+#define TC_WGMODE_gm 7
+#define TC_WGMODE_NORMAL_gc 0
+#define TC_WGMODE_FRQ_gc 1
+#define TC_WGMODE_SS_gc 3
+#define TC0_CCAEN_bm 0x10
+#define TC0_CCBEN_bm 0x20
+#define TC0_CCCEN_bm 0x40
+#define TC0_CCDEN_bm 0x80
+#define TC1_CCAEN_bm 0x10
+#define TC1_CCBEN_bm 0x20
+#define TC_EVACT_gm 0xE0
+#define TC_EVACT_OFF_gc 0
+#define TC_EVACT_CAPT_gc 0x20
+#define TC_EVACT_RESTART_gc 0x80
+#define TC_EVSEL_gm 0x0F
+#define TC_EVSEL_OFF_gc 0
+#define TC_EVSEL_CH0_gc 8
+#define TC_EVSEL_CH4_gc 12
+#define TC_OVFINTLVL_gm 3
+#define TC_OVFINTLVL_OFF_gc 0
+#define TC_OVFINTLVL_LO_gc 1
+#define TC_OVFINTLVL_MED_gc 2
+#define TC_OVFINTLVL_HI_gc 3
+#define TC_CCAINTLVL_gm 3
+#define TC_CCAINTLVL_OFF_gc 0
+#define TC_CCAINTLVL_LO_gc 1
+#define TC_CCAINTLVL_HI_gc 3
+#define TC0_CCAIF_bm 0x10
+#define TC0_CCBIF_bm 0x20
+#define TC0_CCCIF_bm 0x40
+#define TC0_CCDIF_bm 0x80
+#define TC0_OVFIF_bm 1
+#define TC1_OVFIF_bm 1
+#define TC1_CCAIF_bm 0x10
+#define TC_CMD_gm 0x0C
+#define TC_CMD_RESTART_gc 0x08
+#define TC_CMD_UPDATE_gc 0x04
+#define TC0_DIR_bm 1
+#define TC0_LUPD_bm 2
+#define TC0_CMPA_bm 1
+#define DMA_ENABLE_bm 0x80
+#define DMA_RESET_bm 0x40
+#define DMA_DBUFMODE_gm 0x0C
+#define DMA_DBUFMODE_DISABLED_gc 0
+#define DMA_PRIMODE_gm 3
+#define DMA_PRIMODE_RR0123_gc 0
+#define DMA_CH_ENABLE_bm 0x80
+#define DMA_CH_RESET_bm 0x40
+#define DMA_CH_REPEAT_bm 0x20
+#define DMA_CH_TRFREQ_bm 0x10
+#define DMA_CH_SINGLE_bm 0x04
+#define DMA_CH_BURSTLEN_gm 3
+#define DMA_CH_BURSTLEN_1BYTE_gc 0
+#define DMA_CH_TRNINTLVL_gm 3
+#define DMA_CH_TRNINTLVL_OFF_gc 0
+#define DMA_CH_TRNINTLVL_LO_gc 1
+#define DMA_CH_TRNINTLVL_MED_gc 2
+#define DMA_CH_TRNINTLVL_HI_gc 3
+#define DMA_CH_TRNIF_bm 0x10
+#define DMA_CH_ERRIF_bm 0x20
+#define DMA_CH_SRCRELOAD_gm 0xC0
+#define DMA_CH_SRCRELOAD_NONE_gc 0
+#define DMA_CH_SRCDIR_gm 0x30
+#define DMA_CH_SRCDIR_FIXED_gc 0
+#define DMA_CH_DESTRELOAD_gm 0x0C
+#define DMA_CH_DESTRELOAD_NONE_gc 0
+#define DMA_CH_DESTRELOAD_TRANSACTION_gc 0x0C
+#define DMA_CH_DESTDIR_gm 3
+#define DMA_CH_DESTDIR_INC_gc 1
+#define DMA_CH_TRIGSRC_TCD1_OVF_gc 0x8C
+#define PORT_INT0LVL_OFF_gc 0
+#define PORT_INT0LVL_LO_gc 1
+#define PORT_INT1LVL_OFF_gc 0
+#define PORT_INT1LVL_LO_gc 4
+#define PORT_INT0LVL_MED_gc 2
+#define PORT_INT0LVL_HI_gc 3
+#define PORT_INT1LVL_MED_gc 8
+#define PORT_INT1LVL_HI_gc 12
+#define PORTCFG_VPCTRLA PORTCFG.VPCTRLA
+#define PORTCFG_VPCTRLB PORTCFG.VPCTRLB
+#define PORTCFG_VP02MAP_PORTA_gc (0x00<<0)
+#define PORTCFG_VP02MAP_PORTC_gc (0x02<<0)
+#define PORTCFG_VP13MAP_PORTB_gc (0x01<<4)
+#define PORTCFG_VP13MAP_PORTD_gc (0x03<<4)
+#define DMA_CTRL DMA.CTRL
+#define DMA_CH0_CTRLA DMA.CH0.CTRLA
+#define DMA_CH0_CTRLB DMA.CH0.CTRLB
+#define DMA_CH0_ADDRCTRL DMA.CH0.ADDRCTRL
+#define DMA_CH0_TRIGSRC DMA.CH0.TRIGSRC
+#define DMA_CH0_TRFCNT DMA.CH0.TRFCNT
+#define DMA_CH0_REPCNT DMA.CH0.REPCNT
+#define DMA_CH0_SRCADDR0 DMA.CH0.SRCADDR0
+#define DMA_CH0_SRCADDR1 DMA.CH0.SRCADDR1
+#define DMA_CH0_SRCADDR2 DMA.CH0.SRCADDR2
+#define DMA_CH0_DESTADDR0 DMA.CH0.DESTADDR0
+#define DMA_CH0_DESTADDR1 DMA.CH0.DESTADDR1
+#define DMA_CH0_DESTADDR2 DMA.CH0.DESTADDR2
+#define DMA_CH_SRCRELOAD_BLOCK_gc 0x40
+#define DMA_CH_SRCDIR_INC_gc 0x10
+#define DMA_CH_DESTRELOAD_BURST_gc 0x08
+#define DMA_CH_BURSTLEN_2BYTE_gc 1
+#define DMA_CH_TRIGSRC_TCC0_CCA_gc 0x42
+#define DMA_CH_CHBUSY_bm 0x80
+#define DMA_CH_CHPEND_bm 0x40
+
+#endif /* _STUB_AVR_IO_H_ */
@@ -0,0 +1,9 @@
+/* Host stand-in for avr/pgmspace.h */
+#ifndef _STUB_AVR_PGMSPACE_H_
+#define _STUB_AVR_PGMSPACE_H_
+
+#define PROGMEM
+#define pgm_read_byte(a) (*(const uint8_t*)(a))
+#define pgm_read_word(a) (*(const uint16_t*)(a))
+
+#endif /* _STUB_AVR_PGMSPACE_H_ */
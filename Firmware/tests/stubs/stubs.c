@@ -0,0 +1,124 @@
+#include <string.h>
+#include "stubs.h"
+#include "hwbp_core.h"
+#include "app_ios_and_regs.h"
+
+
+/************************************************************************/
+/* Peripherals                                                          */
+/************************************************************************/
+PORT_t PORTA, PORTB, PORTC, PORTD, PORTE;
+VPORT_t VPORT0, VPORT1, VPORT2, VPORT3;
+TC0_t TCC0, TCD0, TCE0;
+TC1_t TCC1, TCD1;
+EVSYS_t EVSYS;
+DMA_t DMA;
+PMIC_t PMIC;
+PORTCFG_t PORTCFG;
+register8_t SREG;
+
+AppRegs app_regs;
+
+void stub_set_inputs(uint16_t inputs)
+{
+	VPORT0.IN = (VPORT0.IN & 0xC0) | (~inputs & 0x3F);
+	VPORT1.IN = (VPORT1.IN & 0xF8) | (~(inputs >> 6) & 0x07);
+	PORTA.IN = VPORT0.IN;
+	PORTB.IN = VPORT1.IN;
+}
+
+void (*stub_vport_hook)(uint16_t reads);
+uint16_t stub_vport_reads;
+
+uint8_t stub_vport_in(VPORT_t *vport)
+{
+	uint8_t value = vport->IN;
+	stub_vport_reads++;
+	if (stub_vport_hook)
+		stub_vport_hook(stub_vport_reads);
+	return value;
+}
+
+
+/************************************************************************/
+/* Core                                                                 */
+/************************************************************************/
+uint32_t stub_time_second;
+uint16_t stub_time_usecond;
+stub_event_t stub_events[STUB_EVENTS_MAX];
+uint16_t stub_events_count;
+
+static uint32_t user_second;
+static uint16_t user_usecond;
+
+void stub_reset(void)
+{
+	memset(&PORTA, 0, sizeof(PORTA));
+	memset(&PORTB, 0, sizeof(PORTB));
+	memset(&PORTC, 0, sizeof(PORTC));
+	memset(&TCC0, 0, sizeof(TCC0));
+	memset(&TCD0, 0, sizeof(TCD0));
+	memset(&TCE0, 0, sizeof(TCE0));
+	memset(&TCD1, 0, sizeof(TCD1));
+	memset(&app_regs, 0, sizeof(app_regs));
+	stub_set_inputs(0);
+	stub_vport_hook = 0;
+	stub_vport_reads = 0;
+	
+	stub_time_second = 0;
+	stub_time_usecond = 0;
+	stub_time_hook = 0;
+	stub_events_count = 0;
+}
+
+void core_func_mark_user_timestamp(void)
+{
+	user_second = stub_time_second;
+	user_usecond = stub_time_usecond;
+}
+
+void core_func_read_user_timestamp(uint32_t *seconds, uint16_t *useconds)
+{
+	*seconds = user_second;
+	*useconds = user_usecond;
+}
+
+void core_func_update_user_timestamp(uint32_t seconds, uint16_t useconds)
+{
+	user_second = seconds;
+	user_usecond = useconds;
+}
+
+void (*stub_time_hook)(void);
+
+uint32_t core_func_read_R_TIMESTAMP_SECOND(void)
+{
+	uint32_t second = stub_time_second;
+	if (stub_time_hook)
+		stub_time_hook();
+	return second;
+}
+
+uint16_t core_func_read_R_TIMESTAMP_MICRO(void)
+{
+	return stub_time_usecond;
+}
+
+void core_func_send_event(uint8_t add, bool use_core_timestamp)
+{
+	if (stub_events_count == STUB_EVENTS_MAX)
+		return;
+	
+	stub_events[stub_events_count].add = add;
+	stub_events[stub_events_count].second = use_core_timestamp ? stub_time_second : user_second;
+	stub_events[stub_events_count].usecond = use_core_timestamp ? stub_time_usecond : user_usecond;
+	stub_events_count++;
+}
+
+bool core_bool_is_visual_enabled(void)
+{
+	return true;
+}
+
+void timer_type0_pwm(TC0_t* timer, uint8_t prescaler, uint16_t target_count, uint16_t duty_cycle_count, uint8_t int_level_ovf, uint8_t int_level_cca) {}
+void timer_type0_stop(TC0_t* timer) {}
@@ -0,0 +1,39 @@
+#ifndef _STUBS_H_
+#define _STUBS_H_
+#include <avr/io.h>
+
+
+/************************************************************************/
+/* Host stubs of the core and the peripherals                           */
+/*                                                                      */
+/* The harp time is set by the tests and latched by the user timestamp  */
+/* functions. The events sent are recorded with their user timestamp.   */
+/************************************************************************/
+#define STUB_EVENTS_MAX 256
+
+typedef struct
+{
+	uint8_t add;
+	uint32_t second;
+	uint16_t usecond;
+} stub_event_t;
+
+extern uint32_t stub_time_second;
+extern uint16_t stub_time_usecond;
+/* Called after each read of R_TIMESTAMP_SECOND */
+extern void (*stub_time_hook)(void);
+extern stub_event_t stub_events[STUB_EVENTS_MAX];
+extern uint16_t stub_events_count;
+
+/* Clears the peripherals, the registers and the recorded events */
+void stub_reset(void);
+
+/* Drives the input pins, which are inverted, to the state of the inputs */
+void stub_set_inputs(uint16_t inputs);
+
+/* Called after each read of a virtual port with the number of reads so far */
+extern void (*stub_vport_hook)(uint16_t reads);
+extern uint16_t stub_vport_reads;
+
+
+#endif /* _STUBS_H_ */
@@ -0,0 +1,42 @@
+#ifndef _TEST_H_
+#define _TEST_H_
+#include <stdio.h>
+
+
+/************************************************************************/
+/* Minimal test runner                                                  */
+/*                                                                      */
+/* Each test file has a main() that runs its tests with RUN_TEST and    */
+/* returns TEST_RESULT(), so ctest reports the failures.                */
+/************************************************************************/
+static int test_failures = 0;
+
+#define CHECK(condition) \
+	do { \
+		if (!(condition)) \
+		{ \
+			printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+			test_failures++; \
+		} \
+	} while (0)
+
+#define CHECK_EQUAL(expected, actual) \
+	do { \
+		long long e = (long long)(expected), a = (long long)(actual); \
+		if (e != a) \
+		{ \
+			printf("%s:%d: %s is %lld, expected %lld\n", __FILE__, __LINE__, #actual, a, e); \
+			test_failures++; \
+		} \
+	} while (0)
+
+#define RUN_TEST(test) \
+	do { \
+		printf("%s\n", #test); \
+		test(); \
+	} while (0)
+
+#define TEST_RESULT() (test_failures ? 1 : 0)
+
+
+#endif /* _TEST_H_ */
@@ -0,0 +1,667 @@
+#include "test.h"
+#include "stubs.h"
+
+/* The static functions are tested directly */
+#include "app_funcs.c"
+
+
+/************************************************************************/
+/* Inputs snapshot                                                      */
+/************************************************************************/
+#define PINS_SEQUENCE_MAX 32
+static uint16_t pins_sequence[PINS_SEQUENCE_MAX];
+static uint16_t pins_sequence_length;
+
+/* Drives the pins to the next state of the sequence after each port read */
+static void move_pins(uint16_t reads)
+{
+	if (reads < pins_sequence_length)
+		stub_set_inputs(pins_sequence[reads]);
+}
+
+static void pins_start(uint16_t length)
+{
+	pins_sequence_length = length;
+	stub_set_inputs(pins_sequence[0]);
+	stub_vport_reads = 0;
+	stub_vport_hook = move_pins;
+}
+
+static void test_snapshot_is_a_state_of_the_pins(void)
+{
+	uint16_t before = B_INPUT0 | B_INPUT8;
+	uint16_t after = B_INPUT6;
+	
+	/* An edge on both ports lands after each one of the reads of the first two tries */
+	for (uint16_t edge = 1; edge <= 2 * (READ_INPUTS_RETRIES + 1); edge++)
+	{
+		stub_reset();
+		for (uint16_t i = 0; i < PINS_SEQUENCE_MAX; i++)
+			pins_sequence[i] = (i < edge) ? before : after;
+		pins_start(PINS_SEQUENCE_MAX);
+		
+		uint16_t state = read_inputs_state() & MSK_INPUTS;
+		CHECK(state == before || state == after);
+		CHECK(stub_vport_reads <= 3 * (READ_INPUTS_RETRIES + 1));
+	}
+}
+
+static void test_snapshot_retries_a_torn_read(void)
+{
+	stub_reset();
+	
+	/* Port B changes between the reads of ports A and B */
+	pins_sequence[0] = B_INPUT0;
+	pins_sequence[1] = B_INPUT6;
+	pins_start(2);
+	
+	CHECK_EQUAL(B_INPUT6, read_inputs_state() & MSK_INPUTS);
+	CHECK_EQUAL(2 * (READ_INPUTS_RETRIES + 1), stub_vport_reads);
+}
+
+static void test_snapshot_gives_up_after_the_tries(void)
+{
+	stub_reset();
+	
+	/* Port A toggles after every read, so each snapshot is still a state of the pins */
+	for (uint16_t i = 0; i < PINS_SEQUENCE_MAX; i++)
+		pins_sequence[i] = (i & 1) ? B_INPUT0 | B_INPUT6 : B_INPUT6;
+	pins_start(PINS_SEQUENCE_MAX);
+	
+	/* The last try reads port A at its 16th read, after 15 moves */
+	CHECK_EQUAL(B_INPUT0 | B_INPUT6, read_inputs_state() & MSK_INPUTS);
+	CHECK_EQUAL(READ_INPUTS_RETRIES * 5, stub_vport_reads);
+	
+	/* When both ports keep toggling, the last snapshot may tear and is returned as is */
+	stub_reset();
+	for (uint16_t i = 0; i < PINS_SEQUENCE_MAX; i++)
+		pins_sequence[i] = (i & 1) ? B_INPUT6 : B_INPUT0;
+	pins_start(PINS_SEQUENCE_MAX);
+	
+	CHECK_EQUAL(0, read_inputs_state() & MSK_INPUTS);
+	CHECK_EQUAL(READ_INPUTS_RETRIES * 5, stub_vport_reads);
+}
+
+
+/************************************************************************/
+/* Hardware capture                                                     */
+/************************************************************************/
+static void simulate_capture(TC0_t *timer, uint8_t channel, uint16_t now, uint16_t age)
+{
+	timer->CNT = now;
+	(&timer->CCA)[channel] = now - age;
+	timer->INTFLAGS |= TC0_CCAIF_bm << channel;
+}
+
+/* The core's second interrupt preempts the latch once, right after a read of the second */
+static void wrap_second(void)
+{
+	stub_time_hook = 0;
+	stub_time_second++;
+	stub_time_usecond = 0;
+}
+
+static void test_latch_timestamp_survives_a_micro_wrap(void)
+{
+	stub_reset();
+	stub_time_second = 9;
+	stub_time_usecond = TIMESTAMP_USECONDS_PER_SECOND - 1;
+	stub_time_hook = wrap_second;
+	
+	latch_read_timestamp();
+	CHECK_EQUAL(10, latch_second);
+	CHECK_EQUAL(0, latch_usecond);
+}
+
+static void test_capture_moves_the_timestamp_to_the_edge(void)
+{
+	stub_reset();
+	inputs_edges_config(MSK_INPUTS, MSK_INPUTS);
+	stub_time_second = 10;
+	stub_time_usecond = 1000;
+	
+	/* 100 ticks of 2 us are 6.25 units of 32 us, rounded to 6 */
+	simulate_capture(&TCD0, 1, 5000, 100);
+	latch_capture_timestamp();
+	CHECK_EQUAL(10, latch_second);
+	CHECK_EQUAL(994, latch_usecond);
+	CHECK_EQUAL(200, app_regs.REG_CAPTURE_LATENCY_MAX);
+}
+
+static void test_capture_uses_the_oldest_edge_of_both_timers(void)
+{
+	stub_reset();
+	inputs_edges_config(MSK_INPUTS, MSK_INPUTS);
+	stub_time_second = 10;
+	stub_time_usecond = 3;
+	
+	/* The capture wraps around the timer and the timestamp borrows a second */
+	simulate_capture(&TCD0, 0, 0x0010, 0x20);
+	simulate_capture(&TCE0, 3, 0x8000, 160);
+	latch_capture_timestamp();
+	CHECK_EQUAL(9, latch_second);
+	CHECK_EQUAL(TIMESTAMP_USECONDS_PER_SECOND + 3 - 10, latch_usecond);
+}
+
+static void test_capture_ignores_the_disabled_inputs(void)
+{
+	stub_reset();
+	inputs_edges_config(B_INPUT0, B_INPUT0);
+	stub_time_second = 10;
+	stub_time_usecond = 1000;
+	
+	simulate_capture(&TCD0, 2, 5000, 1000);
+	latch_capture_timestamp();
+	CHECK_EQUAL(1000, latch_usecond);
+}
+
+static void test_capture_start_keeps_the_time_base(void)
+{
+	stub_reset();
+	time_base_high = 3;
+	
+	/* The counter has just wrapped and its overflow interrupt is still pending */
+	TCD0.CNT = 0x0012;
+	TCD0.INTFLAGS = TC0_OVFIF_bm;
+	uint8_t flags = TCD0.INTFLAGS;
+	uint32_t before = time_base_ticks();
+	CHECK_EQUAL(0x40012UL, before);
+	
+	capture_start();
+	CHECK_EQUAL(0x0012, TCD0.CNT);
+	
+	/* The flags are cleared by writing ones, so the pending overflow is kept
+	 * unless its bit was written, which the stub only records */
+	uint8_t written = TCD0.INTFLAGS;
+	CHECK(!(written & TC0_OVFIF_bm));
+	TCD0.INTFLAGS = flags & ~written;
+	CHECK(TCD0.INTFLAGS & TC0_OVFIF_bm);
+	CHECK_EQUAL(before, time_base_ticks());
+	
+	/* The overflow is then served, which clears its flag */
+	TCD0_OVF_vect();
+	TCD0.INTFLAGS &= ~TC0_OVFIF_bm;
+	CHECK_EQUAL(4, time_base_high);
+	CHECK_EQUAL(before, time_base_ticks());
+	
+	capture_stop();
+	CHECK_EQUAL(before, time_base_ticks());
+}
+
+
+/************************************************************************/
+/* Sampling timer                                                       */
+/************************************************************************/
+static void test_sampling_period_sets_the_timer(void)
+{
+	uint8_t mode = GM_INMODE_TIMER;
+	uint16_t periods[] = {200, 100, 1234, 16383};
+	uint16_t pers[] = {799, 399, 4935, 65531};
+	
+	stub_reset();
+	app_regs.REG_INPUTS_INT_LEVEL = INT_LEVEL_LOW;
+	app_regs.REG_SAMPLING_PERIOD = 1000;
+	app_write_REG_INPUT_CATCH_MODE(&mode);
+	CHECK_EQUAL(3999, TCD1.PER);
+	CHECK_EQUAL(TC_CLKSEL_DIV8_gc, TCD1.CTRLA);
+	CHECK_EQUAL(INT_LEVEL_LOW, TCD1.INTCTRLA);
+	
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		CHECK(app_write_REG_SAMPLING_PERIOD(&periods[i]));
+		CHECK_EQUAL(periods[i], app_regs.REG_SAMPLING_PERIOD);
+		CHECK_EQUAL(pers[i], TCD1.PER);
+	}
+}
+
+static void test_sampling_period_rejects_out_of_range(void)
+{
+	uint8_t mode = GM_INMODE_TIMER;
+	uint16_t period = 200;
+	uint16_t invalid[] = {0, 99, 16384, 0xFFFF};
+	
+	stub_reset();
+	app_regs.REG_INPUTS_INT_LEVEL = INT_LEVEL_LOW;
+	app_regs.REG_SAMPLING_PERIOD = period;
+	app_write_REG_INPUT_CATCH_MODE(&mode);
+	
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		CHECK(!app_write_REG_SAMPLING_PERIOD(&invalid[i]));
+		CHECK_EQUAL(200, app_regs.REG_SAMPLING_PERIOD);
+		CHECK_EQUAL(799, TCD1.PER);
+	}
+}
+
+static void test_sampling_timer_only_latches(void)
+{
+	uint8_t mode = GM_INMODE_TIMER;
+	input_reading_t reading;
+	
+	stub_reset();
+	input_fifo_flush();
+	app_regs.REG_INPUTS_INT_LEVEL = INT_LEVEL_LOW;
+	app_regs.REG_SAMPLING_PERIOD = 200;
+	app_regs.REG_EVNT_ENABLE = B_EVT0;
+	app_write_REG_INPUT_CATCH_MODE(&mode);
+	inputs_state_reset();
+	
+	stub_time_second = 3;
+	stub_set_inputs(0x105);
+	TCD1_OVF_vect();
+	
+	/* The reading is sent by the main loop */
+	CHECK_EQUAL(0, stub_events_count);
+	CHECK_EQUAL(0, app_regs.REG_INPUTS_STATE);
+	
+	CHECK(input_fifo_pop(&reading));
+	CHECK_EQUAL(INPUT_READING_SAMPLE, reading.kind);
+	CHECK_EQUAL(0x105, reading.state & MSK_INPUTS);
+	CHECK_EQUAL(3, reading.second);
+	CHECK(!input_fifo_pop(&reading));
+}
+
+
+/************************************************************************/
+/* DO0 logic                                                            */
+/************************************************************************/
+static bool logic_table_output(uint16_t state)
+{
+	return (logic_table[state >> 3] >> (state & 7)) & 1;
+}
+
+static void test_logic_table_and(void)
+{
+	stub_reset();
+	app_regs.REG_LOGIC_MASK = B_INPUT0 | (1 << 8);
+	app_regs.REG_LOGIC_FUNCTION = GM_LOGIC_AND;
+	logic_table_build();
+	
+	CHECK(!logic_table_output(0));
+	CHECK(!logic_table_output(B_INPUT0));
+	CHECK(!logic_table_output(1 << 8));
+	CHECK(logic_table_output(B_INPUT0 | (1 << 8)));
+	CHECK(logic_table_output(0x1FF));
+	
+	/* An empty mask never sets the output */
+	app_regs.REG_LOGIC_MASK = 0;
+	logic_table_build();
+	CHECK(!logic_table_output(0x1FF));
+}
+
+static void test_logic_table_or_and_xor(void)
+{
+	stub_reset();
+	app_regs.REG_LOGIC_MASK = 0x0E;
+	app_regs.REG_LOGIC_FUNCTION = GM_LOGIC_OR;
+	logic_table_build();
+	
+	CHECK(!logic_table_output(0x1F1));
+	CHECK(logic_table_output(0x04));
+	
+	app_regs.REG_LOGIC_FUNCTION = GM_LOGIC_XOR;
+	logic_table_build();
+	
+	CHECK(!logic_table_output(0));
+	CHECK(logic_table_output(0x02));
+	CHECK(!logic_table_output(0x06));
+	CHECK(logic_table_output(0x0E));
+	CHECK(logic_table_output(0x1F3));
+}
+
+static void test_logic_table_threshold(void)
+{
+	stub_reset();
+	app_regs.REG_LOGIC_MASK = 0x1FF;
+	app_regs.REG_LOGIC_FUNCTION = GM_LOGIC_THRESHOLD;
+	app_regs.REG_LOGIC_THRESHOLD = 3;
+	logic_table_build();
+	
+	for (uint16_t state = 0; state < 512; state++)
+		CHECK_EQUAL(__builtin_popcount(state) >= 3, logic_table_output(state));
+}
+
+
+/************************************************************************/
+/* Inputs' edges                                                        */
+/************************************************************************/
+static void test_edges_detected_on_both_edges(void)
+{
+	stub_reset();
+	inputs_edges_config(MSK_INPUTS, MSK_INPUTS);
+	last_processed_state = 0x001;
+	
+	CHECK_EQUAL(0x000, inputs_edges_detected(0x001, INPUTS_OF_PORTA_INT1, 0));
+	CHECK_EQUAL(0x003, inputs_edges_detected(0x002, INPUTS_OF_PORTA_INT0, 0));
+	CHECK_EQUAL(0x100, inputs_edges_detected(0x101, INPUTS_OF_PORTB_INT0, 0));
+	CHECK_EQUAL(0x000, inputs_edges_detected(0x101, INPUTS_OF_PORTB_INT0, 0x100));
+}
+
+static void test_edges_detected_on_single_edge(void)
+{
+	stub_reset();
+	inputs_edges_config(B_INPUT0 | 0x004, 0x002 | 0x004);
+	last_processed_state = 0;
+	
+	/* A real transition to the edge's level */
+	CHECK_EQUAL(B_INPUT0, inputs_edges_detected(B_INPUT0, INPUTS_OF_PORTA_INT1, 0));
+	CHECK_EQUAL(0x000, inputs_edges_detected(0x000, INPUTS_OF_PORTA_INT1, 0));
+	
+	/* Another input of the same interrupt changed, so it explains the interrupt */
+	CHECK_EQUAL(0x004, inputs_edges_detected(0x004, INPUTS_OF_PORTA_INT0, 0));
+	
+	/* Nothing else changed, so the input at its level had the edge */
+	last_processed_state = B_INPUT0;
+	CHECK_EQUAL(B_INPUT0, inputs_edges_detected(B_INPUT0, INPUTS_OF_PORTA_INT1, 0));
+	CHECK_EQUAL(0x002, inputs_edges_detected(B_INPUT0, INPUTS_OF_PORTA_INT0, 0));
+	
+	/* Disabled inputs are never reported */
+	CHECK_EQUAL(0x000, inputs_edges_detected(B_INPUT0 | 0x008, INPUTS_OF_PORTA_INT0, 0x002));
+}
+
+static void process_pending_readings(void)
+{
+	input_reading_t reading;
+	
+	while (input_fifo_pop(&reading))
+		process(&reading);
+}
+
+static void test_single_edge_input_ignores_other_interrupts(void)
+{
+	uint8_t mode = GM_INMODE_WHEN_ANY_CHANGE;
+	
+	stub_reset();
+	input_fifo_flush();
+	app_regs.REG_INPUTS_INT_LEVEL = INT_LEVEL_LOW;
+	app_regs.REG_INPUTS_RISING_EDGE = MSK_INPUTS;
+	app_regs.REG_INPUTS_FALLING_EDGE = MSK_INPUTS & ~B_INPUT0;
+	app_write_REG_INPUT_CATCH_MODE(&mode);
+	inputs_state_reset();
+	
+	stub_set_inputs(B_INPUT0);
+	PORTA_INT1_vect();
+	process_pending_readings();
+	
+	/* DI1 toggles while DI0 stays high */
+	for (uint8_t i = 0; i < 10; i++)
+	{
+		stub_set_inputs(B_INPUT0 | ((i & 1) ? 0 : 0x002));
+		PORTA_INT0_vect();
+		process_pending_readings();
+	}
+	
+	CHECK_EQUAL(1, app_regs.REG_INPUTS_EDGE_COUNT[0]);
+	CHECK_EQUAL(10, app_regs.REG_INPUTS_EDGE_COUNT[1]);
+}
+
+static void test_dead_time_masks_the_input_interrupt(void)
+{
+	uint8_t mode = GM_INMODE_WHEN_ANY_CHANGE;
+	
+	stub_reset();
+	input_fifo_flush();
+	app_regs.REG_INPUTS_INT_LEVEL = INT_LEVEL_LOW;
+	app_regs.REG_INPUTS_RISING_EDGE = MSK_INPUTS;
+	app_regs.REG_INPUTS_FALLING_EDGE = MSK_INPUTS;
+	app_regs.REG_INPUTS_DEAD_TIME[1] = 100;
+	app_write_REG_INPUT_CATCH_MODE(&mode);
+	dead_time_reset();
+	inputs_state_reset();
+	CHECK_EQUAL(INPUTS_OF_PORTA_INT0, PORTA_INT0MASK);
+	
+	/* DI1 rises and is locked for 50 ticks */
+	TCD0.CNT = 1000;
+	stub_set_inputs(0x002);
+	PORTA_INT0_vect();
+	process_pending_readings();
+	CHECK_EQUAL(INPUTS_OF_PORTA_INT0 & ~0x002, PORTA_INT0MASK);
+	CHECK_EQUAL(INPUTS_OF_PORTA_INT1, PORTA_INT1MASK);
+	
+	/* It bounces back low, seen by a reading of DI2 */
+	stub_set_inputs(0x004);
+	PORTA_INT0_vect();
+	process_pending_readings();
+	CHECK_EQUAL(0x004 | 0x002, app_regs.REG_INPUTS_STATE);
+	
+	TCD0.CNT = 1049;
+	update_dead_time();
+	CHECK_EQUAL(INPUTS_OF_PORTA_INT0 & ~0x002, PORTA_INT0MASK);
+	
+	/* The end of the dead time unmasks it and reports the hidden change */
+	TCD0.CNT = 1050;
+	update_dead_time();
+	CHECK_EQUAL(INPUTS_OF_PORTA_INT0, PORTA_INT0MASK);
+	CHECK_EQUAL(1, app_regs.REG_INPUTS_GLITCHES[1]);
+	process_pending_readings();
+	CHECK_EQUAL(0x004, app_regs.REG_INPUTS_STATE);
+}
+
+static void test_period_saturates(void)
+{
+	stub_reset();
+	edges_rising = MSK_INPUTS;
+	edges_falling = MSK_INPUTS;
+	edge_counters_reset_periods();
+	
+	edge_counters_update(B_INPUT0, B_INPUT0, 100);
+	edge_counters_update(B_INPUT0, B_INPUT0, 100UL + 0x7FFFFFFF);
+	CHECK_EQUAL(0xFFFFFFFE, app_regs.REG_INPUTS_PERIOD[0]);
+	
+	edge_counters_update(B_INPUT0, B_INPUT0, (uint32_t)(100UL + 0x7FFFFFFF + 0x80000000));
+	CHECK_EQUAL(0xFFFFFFFF, app_regs.REG_INPUTS_PERIOD[0]);
+}
+
+static void test_hidden_change_is_counted(void)
+{
+	uint8_t mode = GM_INMODE_WHEN_ANY_CHANGE;
+	
+	stub_reset();
+	input_fifo_flush();
+	app_regs.REG_INPUTS_INT_LEVEL = INT_LEVEL_LOW;
+	app_regs.REG_INPUTS_RISING_EDGE = MSK_INPUTS;
+	app_regs.REG_INPUTS_FALLING_EDGE = MSK_INPUTS;
+	app_regs.REG_INPUTS_DEAD_TIME[1] = 100;
+	app_write_REG_INPUT_CATCH_MODE(&mode);
+	dead_time_reset();
+	edge_counters_reset_periods();
+	inputs_state_reset();
+	
+	/* DI1 rises and falls back during its dead time */
+	TCD0.CNT = 1000;
+	stub_set_inputs(0x002);
+	PORTA_INT0_vect();
+	process_pending_readings();
+	stub_set_inputs(0);
+	
+	TCD0.CNT = 1050;
+	update_dead_time();
+	process_pending_readings();
+	CHECK_EQUAL(2, app_regs.REG_INPUTS_EDGE_COUNT[1]);
+	CHECK_EQUAL(0, app_regs.REG_INPUTS_STATE);
+}
+
+static void test_reading_is_sent_after_a_host_read(void)
+{
+	uint8_t mode = GM_INMODE_WHEN_ANY_CHANGE;
+	uint32_t second;
+	uint16_t usecond;
+	
+	stub_reset();
+	input_fifo_flush();
+	app_regs.REG_INPUTS_INT_LEVEL = INT_LEVEL_LOW;
+	app_regs.REG_INPUTS_RISING_EDGE = MSK_INPUTS;
+	app_regs.REG_INPUTS_FALLING_EDGE = MSK_INPUTS;
+	app_regs.REG_EVNT_ENABLE = B_EVT0;
+	app_write_REG_INPUT_CATCH_MODE(&mode);
+	dead_time_reset();
+	inputs_state_reset();
+	
+	stub_time_second = 7;
+	stub_set_inputs(0x002);
+	PORTA_INT0_vect();
+	
+	/* The host reads the register before the main loop processes the reading */
+	app_read_REG_INPUTS_STATE();
+	CHECK_EQUAL(0x002, app_regs.REG_INPUTS_STATE);
+	
+	/* The interrupts don't change the user timestamp of the core */
+	core_func_update_user_timestamp(3, 4);
+	stub_set_inputs(0x006);
+	PORTA_INT0_vect();
+	core_func_read_user_timestamp(&second, &usecond);
+	CHECK_EQUAL(3, second);
+	CHECK_EQUAL(4, usecond);
+	
+	process_pending_readings();
+	CHECK_EQUAL(2, stub_events_count);
+	CHECK_EQUAL(ADD_REG_INPUTS_STATE, stub_events[0].add);
+	CHECK_EQUAL(7, stub_events[0].second);
+	CHECK_EQUAL(0x006, app_regs.REG_INPUTS_STATE);
+}
+
+static void test_logic_follows_inputs_without_catch_mode(void)
+{
+	uint8_t catch_mode = GM_INMODE_DISABLED;
+	uint8_t output_mode = GM_OUTMODE_LOGIC;
+	uint8_t function = GM_LOGIC_OR;
+	uint16_t mask = 0x004;
+	input_reading_t reading;
+	
+	stub_reset();
+	input_fifo_flush();
+	app_regs.REG_INPUTS_INT_LEVEL = INT_LEVEL_LOW;
+	app_write_REG_INPUT_CATCH_MODE(&catch_mode);
+	app_write_REG_LOGIC_FUNCTION(&function);
+	app_write_REG_LOGIC_MASK(&mask);
+	app_write_REG_OUTPUT_MODE(&output_mode);
+	logic_table_update();
+	CHECK_EQUAL(0x004, PORTA_INT0MASK);
+	CHECK_EQUAL(PORT_ISC_BOTHEDGES_gc, PORTA.PIN2CTRL & PORT_ISC_gm);
+	
+	stub_set_inputs(0x004);
+	PORTC.OUTSET = 0;
+	PORTA_INT0_vect();
+	CHECK_EQUAL(1, PORTC.OUTSET & 1);
+	
+	stub_set_inputs(0);
+	PORTC.OUTCLR = 0;
+	PORTA_INT0_vect();
+	CHECK_EQUAL(1, PORTC.OUTCLR & 1);
+	CHECK(!input_fifo_pop(&reading));
+	
+	/* A new configuration is applied to DO0 by the next pass of the main loop */
+	mask = 0x001;
+	stub_set_inputs(0x001);
+	PORTC.OUTSET = 0;
+	app_write_REG_LOGIC_MASK(&mask);
+	CHECK_EQUAL(0, PORTC.OUTSET & 1);
+	logic_table_update();
+	CHECK_EQUAL(1, PORTC.OUTSET & 1);
+	CHECK_EQUAL(0x001, PORTA_INT1MASK);
+	CHECK_EQUAL(0x000, PORTA_INT0MASK);
+}
+
+static void test_hardware_pulse_follows_the_edges_of_input0(void)
+{
+	uint8_t catch_mode = GM_INMODE_DISABLED;
+	uint8_t output_mode = GM_OUTMODE_PULSE_HW;
+	uint16_t rising = B_INPUT0;
+	uint16_t none = 0;
+	
+	stub_reset();
+	app_regs.REG_INPUTS_INT_LEVEL = INT_LEVEL_LOW;
+	app_regs.REG_PULSE_WIDTH = 100;
+	app_write_REG_INPUT_CATCH_MODE(&catch_mode);
+	app_write_REG_OUTPUT_MODE(&output_mode);
+	CHECK_EQUAL(TC_EVACT_OFF_gc, TCC0.CTRLD);
+	CHECK_EQUAL(399, TCC0.PER);
+	
+	/* The pin is inverted, so the rising edge of the input is sensed on the falling edge */
+	catch_mode = GM_INMODE_WHEN_ANY_CHANGE;
+	app_write_REG_INPUTS_RISING_EDGE(&rising);
+	app_write_REG_INPUT_CATCH_MODE(&catch_mode);
+	CHECK_EQUAL(TC_EVACT_RESTART_gc | TC_EVSEL_CH0_gc, TCC0.CTRLD);
+	CHECK_EQUAL(PORT_ISC_FALLING_gc, PORTA.PIN0CTRL & PORT_ISC_gm);
+	
+	app_write_REG_INPUTS_RISING_EDGE(&none);
+	CHECK_EQUAL(TC_EVACT_OFF_gc, TCC0.CTRLD);
+	
+	/* The other modes leave the timer alone */
+	output_mode = GM_OUTMODE_INPUT0;
+	app_write_REG_OUTPUT_MODE(&output_mode);
+	app_write_REG_INPUTS_RISING_EDGE(&rising);
+	CHECK_EQUAL(0, TCC0.CTRLD);
+}
+
+static void test_trigger_fires_without_catch_mode(void)
+{
+	uint8_t catch_mode = GM_INMODE_1000Hz;
+	uint8_t output_mode = GM_OUTMODE_TRIGGER;
+	uint16_t rising = 0x008;
+	
+	stub_reset();
+	app_regs.REG_INPUTS_INT_LEVEL = INT_LEVEL_LOW;
+	app_regs.REG_PULSE_WIDTH = 100;
+	app_write_REG_INPUT_CATCH_MODE(&catch_mode);
+	app_write_REG_OUTPUT_MODE(&output_mode);
+	app_write_REG_TRIGGER_RISING_EDGE(&rising);
+	CHECK_EQUAL(0x008, PORTA_INT0MASK);
+	CHECK_EQUAL(TC_CLKSEL_OFF_gc, TCC0.CTRLA);
+	
+	stub_set_inputs(0x008);
+	PORTA_INT0_vect();
+	CHECK_EQUAL(TC_CLKSEL_DIV8_gc, TCC0.CTRLA);
+}
+
+static void test_pattern_starts_without_catch_mode(void)
+{
+	uint8_t catch_mode = GM_INMODE_DISABLED;
+	uint8_t output_mode = GM_OUTMODE_PATTERN;
+	uint16_t trigger = 0x040;
+	uint16_t pattern[32] = {100, 200};
+	
+	stub_reset();
+	app_regs.REG_INPUTS_INT_LEVEL = INT_LEVEL_LOW;
+	app_regs.REG_PATTERN_REPEAT = 1;
+	app_write_REG_INPUT_CATCH_MODE(&catch_mode);
+	app_write_REG_PATTERN(pattern);
+	app_write_REG_OUTPUT_MODE(&output_mode);
+	app_write_REG_PATTERN_TRIGGER(&trigger);
+	CHECK_EQUAL(0x001, PORTB_INT0MASK);
+	CHECK(!pattern_playing);
+	
+	stub_set_inputs(0x040);
+	PORTB_INT0_vect();
+	CHECK(pattern_playing);
+}
+
+int main(void)
+{
+	RUN_TEST(test_snapshot_is_a_state_of_the_pins);
+	RUN_TEST(test_snapshot_retries_a_torn_read);
+	RUN_TEST(test_snapshot_gives_up_after_the_tries);
+	RUN_TEST(test_latch_timestamp_survives_a_micro_wrap);
+	RUN_TEST(test_capture_moves_the_timestamp_to_the_edge);
+	RUN_TEST(test_capture_uses_the_oldest_edge_of_both_timers);
+	RUN_TEST(test_capture_ignores_the_disabled_inputs);
+	RUN_TEST(test_capture_start_keeps_the_time_base);
+	RUN_TEST(test_sampling_period_sets_the_timer);
+	RUN_TEST(test_sampling_period_rejects_out_of_range);
+	RUN_TEST(test_sampling_timer_only_latches);
+	RUN_TEST(test_logic_table_and);
+	RUN_TEST(test_logic_table_or_and_xor);
+	RUN_TEST(test_logic_table_threshold);
+	RUN_TEST(test_edges_detected_on_both_edges);
+	RUN_TEST(test_edges_detected_on_single_edge);
+	RUN_TEST(test_single_edge_input_ignores_other_interrupts);
+	RUN_TEST(test_dead_time_masks_the_input_interrupt);
+	RUN_TEST(test_period_saturates);
+	RUN_TEST(test_hidden_change_is_counted);
+	RUN_TEST(test_reading_is_sent_after_a_host_read);
+	RUN_TEST(test_logic_follows_inputs_without_catch_mode);
+	RUN_TEST(test_hardware_pulse_follows_the_edges_of_input0);
+	RUN_TEST(test_trigger_fires_without_catch_mode);
+	RUN_TEST(test_pattern_starts_without_catch_mode);
+	return TEST_RESULT();
+}
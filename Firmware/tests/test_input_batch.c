@@ -0,0 +1,98 @@
+#include "test.h"
+#include "stubs.h"
+#include "input_batch.h"
+
+
+static void fill_batch(uint16_t first_state, uint32_t second)
+{
+	for (uint8_t i = 0; i < INPUT_BATCH_LENGTH; i++)
+		CHECK(input_batch_add(first_state + i, second, i));
+}
+
+static void test_batch_is_ready_when_full(void)
+{
+	input_batch_reset(500);
+	
+	for (uint8_t i = 0; i < INPUT_BATCH_LENGTH - 1; i++)
+	{
+		CHECK(input_batch_add(i, 10, 100 + i));
+		CHECK(input_batch_peek() == 0);
+	}
+	
+	CHECK(input_batch_add(INPUT_BATCH_LENGTH - 1, 10, 200));
+	
+	input_batch_t *batch = input_batch_peek();
+	CHECK(batch != 0);
+	if (!batch)
+		return;
+	
+	/* The batch has the timestamp of its first reading */
+	CHECK_EQUAL(10, batch->second);
+	CHECK_EQUAL(100, batch->usecond);
+	CHECK_EQUAL(500, batch->period);
+	for (uint8_t i = 0; i < INPUT_BATCH_LENGTH; i++)
+		CHECK_EQUAL(i, batch->state[i]);
+	
+	input_batch_release();
+	CHECK(input_batch_peek() == 0);
+}
+
+static void test_batch_is_dropped_while_the_previous_one_waits(void)
+{
+	input_batch_reset(1000);
+	
+	fill_batch(0, 1);
+	
+	/* The readings go to the other buffer, which is dropped when full */
+	for (uint8_t i = 0; i < INPUT_BATCH_LENGTH - 1; i++)
+		CHECK(input_batch_add(100, 2, 0));
+	CHECK(!input_batch_add(100, 2, 0));
+	
+	input_batch_t *batch = input_batch_peek();
+	CHECK(batch != 0);
+	if (!batch)
+		return;
+	CHECK_EQUAL(1, batch->second);
+	CHECK_EQUAL(0, batch->state[0]);
+	input_batch_release();
+	CHECK(input_batch_peek() == 0);
+	
+	fill_batch(200, 3);
+	batch = input_batch_peek();
+	CHECK(batch != 0);
+	if (!batch)
+		return;
+	CHECK_EQUAL(3, batch->second);
+	CHECK_EQUAL(200, batch->state[0]);
+	input_batch_release();
+}
+
+static void test_batch_reset_discards_the_pending_readings(void)
+{
+	input_batch_reset(1000);
+	
+	for (uint8_t i = 0; i < INPUT_BATCH_LENGTH - 1; i++)
+		CHECK(input_batch_add(1, 1, 0));
+	
+	input_batch_reset(500);
+	for (uint8_t i = 0; i < INPUT_BATCH_LENGTH - 1; i++)
+		CHECK(input_batch_add(2, 2, 0));
+	CHECK(input_batch_peek() == 0);
+	
+	CHECK(input_batch_add(2, 2, 0));
+	input_batch_t *batch = input_batch_peek();
+	CHECK(batch != 0);
+	if (!batch)
+		return;
+	CHECK_EQUAL(2, batch->second);
+	CHECK_EQUAL(500, batch->period);
+	input_batch_release();
+}
+
+int main(void)
+{
+	RUN_TEST(test_batch_is_ready_when_full);
+	RUN_TEST(test_batch_is_dropped_while_the_previous_one_waits);
+	RUN_TEST(test_batch_reset_discards_the_pending_readings);
+	return TEST_RESULT();
+}
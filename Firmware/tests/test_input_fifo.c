@@ -0,0 +1,130 @@
+#include "test.h"
+#include "stubs.h"
+#include "input_fifo.h"
+
+
+static input_reading_t reading_with_state(uint16_t state)
+{
+	input_reading_t reading = {0};
+	
+	reading.state = state;
+	reading.second = state;
+	reading.ticks = (uint32_t)state << 8;
+	reading.kind = INPUT_READING_EDGE;
+	return reading;
+}
+
+static void test_fifo_empty(void)
+{
+	input_reading_t reading;
+	
+	input_fifo_flush();
+	CHECK(!input_fifo_pop(&reading));
+	
+	reading = reading_with_state(1);
+	CHECK(input_fifo_push(&reading));
+	CHECK(input_fifo_pop(&reading));
+	CHECK(!input_fifo_pop(&reading));
+}
+
+static void test_fifo_full(void)
+{
+	input_reading_t reading;
+	
+	input_fifo_flush();
+	
+	/* One slot is kept free to tell a full FIFO from an empty one */
+	for (uint16_t i = 0; i < INPUT_FIFO_SIZE - 1; i++)
+	{
+		reading = reading_with_state(i);
+		CHECK(input_fifo_push(&reading));
+	}
+	
+	reading = reading_with_state(0xFFFF);
+	CHECK(!input_fifo_push(&reading));
+	
+	/* The dropped reading doesn't overwrite the queued ones */
+	for (uint16_t i = 0; i < INPUT_FIFO_SIZE - 1; i++)
+	{
+		CHECK(input_fifo_pop(&reading));
+		CHECK_EQUAL(i, reading.state);
+	}
+	CHECK(!input_fifo_pop(&reading));
+}
+
+static void test_fifo_wraps_in_order(void)
+{
+	input_reading_t reading;
+	uint16_t pushed = 0, popped = 0;
+	
+	input_fifo_flush();
+	
+	/* Keep a few readings queued while the indexes wrap several times */
+	for (uint16_t round = 0; round < INPUT_FIFO_SIZE * 4; round++)
+	{
+		for (uint8_t i = 0; i < 3; i++)
+		{
+			reading = reading_with_state(pushed++);
+			CHECK(input_fifo_push(&reading));
+		}
+		
+		for (uint8_t i = 0; i < 2; i++)
+		{
+			CHECK(input_fifo_pop(&reading));
+			CHECK_EQUAL(popped, reading.state);
+			CHECK_EQUAL(popped, reading.second);
+			CHECK_EQUAL((uint32_t)popped << 8, reading.ticks);
+			popped++;
+		}
+		
+		if (pushed - popped >= INPUT_FIFO_SIZE - 3)
+		{
+			while (input_fifo_pop(&reading))
+				CHECK_EQUAL(popped++, reading.state);
+		}
+	}
+	
+	while (input_fifo_pop(&reading))
+		CHECK_EQUAL(popped++, reading.state);
+	CHECK_EQUAL(pushed, popped);
+}
+
+static void test_fifo_flush(void)
+{
+	input_reading_t reading = reading_with_state(1);
+	
+	CHECK(input_fifo_push(&reading));
+	CHECK(input_fifo_push(&reading));
+	input_fifo_flush();
+	CHECK(!input_fifo_pop(&reading));
+}
+
+static void test_fifo_flush_keeps_later_readings(void)
+{
+	input_reading_t reading;
+	
+	for (uint16_t i = 0; i < 3; i++)
+	{
+		reading = reading_with_state(i);
+		CHECK(input_fifo_push(&reading));
+	}
+	
+	/* The flush is applied by the consumer, so a reading pushed before the pop survives it */
+	input_fifo_flush();
+	reading = reading_with_state(7);
+	CHECK(input_fifo_push(&reading));
+	
+	CHECK(input_fifo_pop(&reading));
+	CHECK_EQUAL(7, reading.state);
+	CHECK(!input_fifo_pop(&reading));
+}
+
+int main(void)
+{
+	RUN_TEST(test_fifo_empty);
+	RUN_TEST(test_fifo_full);
+	RUN_TEST(test_fifo_wraps_in_order);
+	RUN_TEST(test_fifo_flush);
+	RUN_TEST(test_fifo_flush_keeps_later_readings);
+	return TEST_RESULT();
+}
@@ -0,0 +1,158 @@
+#!/usr/bin/env python3
+"""Reads the Telemetry register of the Harp Synchronizer.
+
+Prints one JSON object per reading, with the firmware version of the device
+when it is known, so the counters can be tracked across firmware versions.
+The readings come either from a device on a serial port, polled with read
+commands, or from a recording of the device's raw messages.
+"""
+
+import argparse
+import json
+import struct
+import sys
+import time
+
+ADDRESS_FW_VERSION_H = 6
+ADDRESS_FW_VERSION_L = 7
+ADDRESS_TELEMETRY = 71
+
+MESSAGE_READ = 1
+ERROR_FLAG = 0x08
+TIMESTAMP_FLAG = 0x10
+TYPE_U8 = 0x01
+TYPE_U32 = 0x04
+
+FIELDS = (
+    "EventsSent",
+    "ReadingsDropped",
+    "ReadingsFiltered",
+    "LatencyMax",
+    "LatencyAverage",
+    "LatchCyclesMax",
+    "LatchCyclesAverage",
+)
+
+
+def checksum(data):
+    return sum(data) & 0xFF
+
+
+def read_command(address, payload_type):
+    message = bytes((MESSAGE_READ, 4, address, 255, payload_type))
+    return message + bytes((checksum(message),))
+
+
+def scan(buffer):
+    """Yields the valid messages in the buffer and the number of bytes consumed."""
+    offset = 0
+    while len(buffer) - offset >= 6:
+        size = buffer[offset + 1] + 2
+        if size < 6:
+            offset += 1
+            continue
+        if len(buffer) - offset < size:
+            break
+        message = buffer[offset:offset + size]
+        if checksum(message[:-1]) != message[-1]:
+            offset += 1
+            continue
+        yield message, offset + size
+        offset += size
+
+
+def decode(message):
+    """Returns the address, the timestamp in seconds, the payload type and the payload of a message."""
+    message_type, _, address, _, payload_type = message[:5]
+    if message_type & ERROR_FLAG:
+        return None
+    payload = message[5:-1]
+    seconds = None
+    if payload_type & TIMESTAMP_FLAG:
+        if len(payload) < 6:
+            return None
+        second, micro = struct.unpack_from("<IH", payload)
+        seconds = second + micro * 32e-6
+        payload = payload[6:]
+    return address, seconds, payload_type & ~TIMESTAMP_FLAG, payload
+
+
+def telemetry_record(seconds, payload, version):
+    count = min(len(payload) // 4, len(FIELDS))
+    values = struct.unpack_from("<%dI" % count, payload)
+    record = {"seconds": seconds}
+    if version is not None:
+        record["firmware"] = version
+    record.update(zip(FIELDS, values))
+    return record
+
+
+def read_file(path):
+    with open(path, "rb") as stream:
+        buffer = stream.read()
+
+    for message, _ in scan(buffer):
+        decoded = decode(message)
+        if decoded is None:
+            continue
+        address, seconds, payload_type, payload = decoded
+        if address == ADDRESS_TELEMETRY and payload_type == TYPE_U32:
+            yield telemetry_record(seconds, payload, None)
+
+
+def read_device(port, period, count):
+    import serial
+
+    with serial.Serial(port, 1000000, timeout=1) as device:
+        buffer = bytearray()
+        version = {}
+
+        def request(address, payload_type):
+            device.write(read_command(address, payload_type))
+            deadline = time.monotonic() + 1
+            while time.monotonic() < deadline:
+                buffer.extend(device.read(device.in_waiting or 1))
+                consumed = 0
+                reply = None
+                for message, consumed in scan(buffer):
+                    decoded = decode(message)
+                    if message[0] == MESSAGE_READ and decoded and decoded[0] == address:
+                        reply = decoded
+                        break
+                del buffer[:consumed]
+                if reply:
+                    return reply
+            raise TimeoutError("no reply to the read of register %d" % address)
+
+        for address in (ADDRESS_FW_VERSION_H, ADDRESS_FW_VERSION_L):
+            version[address] = request(address, TYPE_U8)[3][0]
+        firmware = "%d.%d" % (version[ADDRESS_FW_VERSION_H], version[ADDRESS_FW_VERSION_L])
+
+        index = 0
+        while count == 0 or index < count:
+            _, seconds, _, payload = request(ADDRESS_TELEMETRY, TYPE_U32)
+            yield telemetry_record(seconds, payload, firmware)
+            index += 1
+            time.sleep(period)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument("--port", help="serial port of the device")
+    source.add_argument("--file", help="binary file with a recording of the device's raw messages")
+    parser.add_argument("--period", type=float, default=1.0, help="seconds between the reads of the device")
+    parser.add_argument("--count", type=int, default=0, help="number of reads of the device, 0 to read until interrupted")
+    args = parser.parse_args()
+
+    records = read_file(args.file) if args.file else read_device(args.port, args.period, args.count)
+    try:
+        for record in records:
+            print(json.dumps(record), flush=True)
+    except KeyboardInterrupt:
+        pass
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,62 @@
+using Bonsai;
+using Bonsai.Harp;
+using System;
+using System.Collections.Generic;
+using System.ComponentModel;
+using System.Reactive.Linq;
+
+namespace Harp.Synchronizer
+{
+    /// <summary>
+    /// Represents an operator that decodes the digital input readings in each list of messages
+    /// reported by the <see cref="Synchronizer"/> device into a reusable buffer.
+    /// </summary>
+    /// <remarks>
+    /// The same buffer is used for every notification, so its contents are only valid until
+    /// the next list of messages is decoded. Copy the readings if they need to be kept.
+    /// </remarks>
+    [Description("Decodes the digital input readings in each list of messages into a reusable buffer.")]
+    public class DecodeDigitalInputs : Combinator<IList<HarpMessage>, ArraySegment<Timestamped<DigitalInputs>>>
+    {
+        /// <summary>
+        /// Decodes the <see cref="DigitalInputState"/> and <see cref="DigitalInputStateBatch"/> messages
+        /// in each list into the timestamped digital input readings, in the order they were received.
+        /// </summary>
+        /// <param name="source">A sequence of lists of Harp device messages.</param>
+        /// <returns>
+        /// A sequence of array segments over the reusable buffer holding the decoded readings.
+        /// </returns>
+        public override IObservable<ArraySegment<Timestamped<DigitalInputs>>> Process(IObservable<IList<HarpMessage>> source)
+        {
+            return Observable.Defer(() =>
+            {
+                var buffer = new Timestamped<DigitalInputs>[0];
+                return source.Select(messages =>
+                {
+                    var capacity = messages.Count * DigitalInputStateBatch.SampleCount;
+                    if (buffer.Length < capacity)
+                    {
+                        buffer = new Timestamped<DigitalInputs>[capacity];
+                    }
+
+                    var count = 0;
+                    for (int i = 0; i < messages.Count; i++)
+                    {
+                        var message = messages[i];
+                        if (message.Error) continue;
+                        if (message.Address == DigitalInputState.Address)
+                        {
+                            buffer[count++] = DigitalInputState.GetTimestampedPayload(message);
+                        }
+                        else if (message.Address == DigitalInputStateBatch.Address)
+                        {
+                            count += DigitalInputStateBatch.CopyTimestampedSamples(message, buffer, count);
+                        }
+                    }
+
+                    return new ArraySegment<Timestamped<DigitalInputs>>(buffer, 0, count);
+                });
+            });
+        }
+    }
+}
@@ -45,7 +45,39 @@ namespace Harp.Synchronizer
             { 37, typeof(Reserved1) },
             { 38, typeof(Reserved2) },
             { 39, typeof(Reserved3) },
-            { 40, typeof(EnableEvents) }
+            { 40, typeof(EnableEvents) },
+            { 41, typeof(EventQueueOverflows) },
+            { 42, typeof(DigitalInputStateBatch) },
+            { 43, typeof(SamplingPeriod) },
+            { 44, typeof(SamplingEventMode) },
+            { 45, typeof(KeyframeInterval) },
+            { 46, typeof(DigitalInputsRisingEdge) },
+            { 47, typeof(DigitalInputsFallingEdge) },
+            { 48, typeof(DigitalInputsDeadTime) },
+            { 49, typeof(DigitalInputsGlitchCount) },
+            { 50, typeof(DigitalInputsEdgeCount) },
+            { 51, typeof(DigitalInputsPeriod) },
+            { 52, typeof(EdgeCountEventPeriod) },
+            { 53, typeof(DO0PulseWidth) },
+            { 54, typeof(DO0LogicInputs) },
+            { 55, typeof(DO0LogicFunction) },
+            { 56, typeof(DO0LogicThreshold) },
+            { 57, typeof(DO0LogicResetInputs) },
+            { 58, typeof(DO0TriggerRisingEdge) },
+            { 59, typeof(DO0TriggerFallingEdge) },
+            { 60, typeof(DO0TriggerPatternMask) },
+            { 61, typeof(DO0TriggerPattern) },
+            { 62, typeof(DO0TriggerDelay) },
+            { 63, typeof(DO0TriggerRearmMode) },
+            { 64, typeof(DO0TriggerArm) },
+            { 65, typeof(DO0Pattern) },
+            { 66, typeof(DO0PatternRepeat) },
+            { 67, typeof(DO0PatternTrigger) },
+            { 68, typeof(DO0PatternControl) },
+            { 69, typeof(DigitalInputsInterruptLevel) },
+            { 70, typeof(CaptureLatencyMax) },
+            { 71, typeof(Telemetry) },
+            { 72, typeof(TelemetryEventPeriod) }
         };
 
         /// <summary>
@@ -114,11 +146,75 @@ namespace Harp.Synchronizer
     /// <seealso cref="DigitalInputsSamplingMode"/>
     /// <seealso cref="DO0Config"/>
     /// <seealso cref="EnableEvents"/>
+    /// <seealso cref="EventQueueOverflows"/>
+    /// <seealso cref="DigitalInputStateBatch"/>
+    /// <seealso cref="SamplingPeriod"/>
+    /// <seealso cref="SamplingEventMode"/>
+    /// <seealso cref="KeyframeInterval"/>
+    /// <seealso cref="DigitalInputsRisingEdge"/>
+    /// <seealso cref="DigitalInputsFallingEdge"/>
+    /// <seealso cref="DigitalInputsDeadTime"/>
+    /// <seealso cref="DigitalInputsGlitchCount"/>
+    /// <seealso cref="DigitalInputsEdgeCount"/>
+    /// <seealso cref="DigitalInputsPeriod"/>
+    /// <seealso cref="EdgeCountEventPeriod"/>
+    /// <seealso cref="DO0PulseWidth"/>
+    /// <seealso cref="DO0LogicInputs"/>
+    /// <seealso cref="DO0LogicFunction"/>
+    /// <seealso cref="DO0LogicThreshold"/>
+    /// <seealso cref="DO0LogicResetInputs"/>
+    /// <seealso cref="DO0TriggerRisingEdge"/>
+    /// <seealso cref="DO0TriggerFallingEdge"/>
+    /// <seealso cref="DO0TriggerPatternMask"/>
+    /// <seealso cref="DO0TriggerPattern"/>
+    /// <seealso cref="DO0TriggerDelay"/>
+    /// <seealso cref="DO0TriggerRearmMode"/>
+    /// <seealso cref="DO0TriggerArm"/>
+    /// <seealso cref="DO0Pattern"/>
+    /// <seealso cref="DO0PatternRepeat"/>
+    /// <seealso cref="DO0PatternTrigger"/>
+    /// <seealso cref="DO0PatternControl"/>
+    /// <seealso cref="DigitalInputsInterruptLevel"/>
+    /// <seealso cref="CaptureLatencyMax"/>
+    /// <seealso cref="Telemetry"/>
+    /// <seealso cref="TelemetryEventPeriod"/>
     [XmlInclude(typeof(DigitalInputState))]
     [XmlInclude(typeof(DigitalOutputState))]
     [XmlInclude(typeof(DigitalInputsSamplingMode))]
     [XmlInclude(typeof(DO0Config))]
     [XmlInclude(typeof(EnableEvents))]
+    [XmlInclude(typeof(EventQueueOverflows))]
+    [XmlInclude(typeof(DigitalInputStateBatch))]
+    [XmlInclude(typeof(SamplingPeriod))]
+    [XmlInclude(typeof(SamplingEventMode))]
+    [XmlInclude(typeof(KeyframeInterval))]
+    [XmlInclude(typeof(DigitalInputsRisingEdge))]
+    [XmlInclude(typeof(DigitalInputsFallingEdge))]
+    [XmlInclude(typeof(DigitalInputsDeadTime))]
+    [XmlInclude(typeof(DigitalInputsGlitchCount))]
+    [XmlInclude(typeof(DigitalInputsEdgeCount))]
+    [XmlInclude(typeof(DigitalInputsPeriod))]
+    [XmlInclude(typeof(EdgeCountEventPeriod))]
+    [XmlInclude(typeof(DO0PulseWidth))]
+    [XmlInclude(typeof(DO0LogicInputs))]
+    [XmlInclude(typeof(DO0LogicFunction))]
+    [XmlInclude(typeof(DO0LogicThreshold))]
+    [XmlInclude(typeof(DO0LogicResetInputs))]
+    [XmlInclude(typeof(DO0TriggerRisingEdge))]
+    [XmlInclude(typeof(DO0TriggerFallingEdge))]
+    [XmlInclude(typeof(DO0TriggerPatternMask))]
+    [XmlInclude(typeof(DO0TriggerPattern))]
+    [XmlInclude(typeof(DO0TriggerDelay))]
+    [XmlInclude(typeof(DO0TriggerRearmMode))]
+    [XmlInclude(typeof(DO0TriggerArm))]
+    [XmlInclude(typeof(DO0Pattern))]
+    [XmlInclude(typeof(DO0PatternRepeat))]
+    [XmlInclude(typeof(DO0PatternTrigger))]
+    [XmlInclude(typeof(DO0PatternControl))]
+    [XmlInclude(typeof(DigitalInputsInterruptLevel))]
+    [XmlInclude(typeof(CaptureLatencyMax))]
+    [XmlInclude(typeof(Telemetry))]
+    [XmlInclude(typeof(TelemetryEventPeriod))]
     [Description("Filters register-specific messages reported by the Synchronizer device.")]
     public class FilterRegister : FilterRegisterBuilder, INamedElement
     {
@@ -145,16 +241,112 @@ namespace Harp.Synchronizer
     /// <seealso cref="DigitalInputsSamplingMode"/>
     /// <seealso cref="DO0Config"/>
     /// <seealso cref="EnableEvents"/>
+    /// <seealso cref="EventQueueOverflows"/>
+    /// <seealso cref="DigitalInputStateBatch"/>
+    /// <seealso cref="SamplingPeriod"/>
+    /// <seealso cref="SamplingEventMode"/>
+    /// <seealso cref="KeyframeInterval"/>
+    /// <seealso cref="DigitalInputsRisingEdge"/>
+    /// <seealso cref="DigitalInputsFallingEdge"/>
+    /// <seealso cref="DigitalInputsDeadTime"/>
+    /// <seealso cref="DigitalInputsGlitchCount"/>
+    /// <seealso cref="DigitalInputsEdgeCount"/>
+    /// <seealso cref="DigitalInputsPeriod"/>
+    /// <seealso cref="EdgeCountEventPeriod"/>
+    /// <seealso cref="DO0PulseWidth"/>
+    /// <seealso cref="DO0LogicInputs"/>
+    /// <seealso cref="DO0LogicFunction"/>
+    /// <seealso cref="DO0LogicThreshold"/>
+    /// <seealso cref="DO0LogicResetInputs"/>
+    /// <seealso cref="DO0TriggerRisingEdge"/>
+    /// <seealso cref="DO0TriggerFallingEdge"/>
+    /// <seealso cref="DO0TriggerPatternMask"/>
+    /// <seealso cref="DO0TriggerPattern"/>
+    /// <seealso cref="DO0TriggerDelay"/>
+    /// <seealso cref="DO0TriggerRearmMode"/>
+    /// <seealso cref="DO0TriggerArm"/>
+    /// <seealso cref="DO0Pattern"/>
+    /// <seealso cref="DO0PatternRepeat"/>
+    /// <seealso cref="DO0PatternTrigger"/>
+    /// <seealso cref="DO0PatternControl"/>
+    /// <seealso cref="DigitalInputsInterruptLevel"/>
+    /// <seealso cref="CaptureLatencyMax"/>
+    /// <seealso cref="Telemetry"/>
+    /// <seealso cref="TelemetryEventPeriod"/>
     [XmlInclude(typeof(DigitalInputState))]
     [XmlInclude(typeof(DigitalOutputState))]
     [XmlInclude(typeof(DigitalInputsSamplingMode))]
     [XmlInclude(typeof(DO0Config))]
     [XmlInclude(typeof(EnableEvents))]
+    [XmlInclude(typeof(EventQueueOverflows))]
+    [XmlInclude(typeof(DigitalInputStateBatch))]
+    [XmlInclude(typeof(SamplingPeriod))]
+    [XmlInclude(typeof(SamplingEventMode))]
+    [XmlInclude(typeof(KeyframeInterval))]
+    [XmlInclude(typeof(DigitalInputsRisingEdge))]
+    [XmlInclude(typeof(DigitalInputsFallingEdge))]
+    [XmlInclude(typeof(DigitalInputsDeadTime))]
+    [XmlInclude(typeof(DigitalInputsGlitchCount))]
+    [XmlInclude(typeof(DigitalInputsEdgeCount))]
+    [XmlInclude(typeof(DigitalInputsPeriod))]
+    [XmlInclude(typeof(EdgeCountEventPeriod))]
+    [XmlInclude(typeof(DO0PulseWidth))]
+    [XmlInclude(typeof(DO0LogicInputs))]
+    [XmlInclude(typeof(DO0LogicFunction))]
+    [XmlInclude(typeof(DO0LogicThreshold))]
+    [XmlInclude(typeof(DO0LogicResetInputs))]
+    [XmlInclude(typeof(DO0TriggerRisingEdge))]
+    [XmlInclude(typeof(DO0TriggerFallingEdge))]
+    [XmlInclude(typeof(DO0TriggerPatternMask))]
+    [XmlInclude(typeof(DO0TriggerPattern))]
+    [XmlInclude(typeof(DO0TriggerDelay))]
+    [XmlInclude(typeof(DO0TriggerRearmMode))]
+    [XmlInclude(typeof(DO0TriggerArm))]
+    [XmlInclude(typeof(DO0Pattern))]
+    [XmlInclude(typeof(DO0PatternRepeat))]
+    [XmlInclude(typeof(DO0PatternTrigger))]
+    [XmlInclude(typeof(DO0PatternControl))]
+    [XmlInclude(typeof(DigitalInputsInterruptLevel))]
+    [XmlInclude(typeof(CaptureLatencyMax))]
+    [XmlInclude(typeof(Telemetry))]
+    [XmlInclude(typeof(TelemetryEventPeriod))]
     [XmlInclude(typeof(TimestampedDigitalInputState))]
     [XmlInclude(typeof(TimestampedDigitalOutputState))]
     [XmlInclude(typeof(TimestampedDigitalInputsSamplingMode))]
     [XmlInclude(typeof(TimestampedDO0Config))]
     [XmlInclude(typeof(TimestampedEnableEvents))]
+    [XmlInclude(typeof(TimestampedEventQueueOverflows))]
+    [XmlInclude(typeof(TimestampedDigitalInputStateBatch))]
+    [XmlInclude(typeof(TimestampedSamplingPeriod))]
+    [XmlInclude(typeof(TimestampedSamplingEventMode))]
+    [XmlInclude(typeof(TimestampedKeyframeInterval))]
+    [XmlInclude(typeof(TimestampedDigitalInputsRisingEdge))]
+    [XmlInclude(typeof(TimestampedDigitalInputsFallingEdge))]
+    [XmlInclude(typeof(TimestampedDigitalInputsDeadTime))]
+    [XmlInclude(typeof(TimestampedDigitalInputsGlitchCount))]
+    [XmlInclude(typeof(TimestampedDigitalInputsEdgeCount))]
+    [XmlInclude(typeof(TimestampedDigitalInputsPeriod))]
+    [XmlInclude(typeof(TimestampedEdgeCountEventPeriod))]
+    [XmlInclude(typeof(TimestampedDO0PulseWidth))]
+    [XmlInclude(typeof(TimestampedDO0LogicInputs))]
+    [XmlInclude(typeof(TimestampedDO0LogicFunction))]
+    [XmlInclude(typeof(TimestampedDO0LogicThreshold))]
+    [XmlInclude(typeof(TimestampedDO0LogicResetInputs))]
+    [XmlInclude(typeof(TimestampedDO0TriggerRisingEdge))]
+    [XmlInclude(typeof(TimestampedDO0TriggerFallingEdge))]
+    [XmlInclude(typeof(TimestampedDO0TriggerPatternMask))]
+    [XmlInclude(typeof(TimestampedDO0TriggerPattern))]
+    [XmlInclude(typeof(TimestampedDO0TriggerDelay))]
+    [XmlInclude(typeof(TimestampedDO0TriggerRearmMode))]
+    [XmlInclude(typeof(TimestampedDO0TriggerArm))]
+    [XmlInclude(typeof(TimestampedDO0Pattern))]
+    [XmlInclude(typeof(TimestampedDO0PatternRepeat))]
+    [XmlInclude(typeof(TimestampedDO0PatternTrigger))]
+    [XmlInclude(typeof(TimestampedDO0PatternControl))]
+    [XmlInclude(typeof(TimestampedDigitalInputsInterruptLevel))]
+    [XmlInclude(typeof(TimestampedCaptureLatencyMax))]
+    [XmlInclude(typeof(TimestampedTelemetry))]
+    [XmlInclude(typeof(TimestampedTelemetryEventPeriod))]
     [Description("Filters and selects specific messages reported by the Synchronizer device.")]
     public partial class Parse : ParseBuilder, INamedElement
     {
@@ -178,11 +370,75 @@ namespace Harp.Synchronizer
     /// <seealso cref="DigitalInputsSamplingMode"/>
     /// <seealso cref="DO0Config"/>
     /// <seealso cref="EnableEvents"/>
+    /// <seealso cref="EventQueueOverflows"/>
+    /// <seealso cref="DigitalInputStateBatch"/>
+    /// <seealso cref="SamplingPeriod"/>
+    /// <seealso cref="SamplingEventMode"/>
+    /// <seealso cref="KeyframeInterval"/>
+    /// <seealso cref="DigitalInputsRisingEdge"/>
+    /// <seealso cref="DigitalInputsFallingEdge"/>
+    /// <seealso cref="DigitalInputsDeadTime"/>
+    /// <seealso cref="DigitalInputsGlitchCount"/>
+    /// <seealso cref="DigitalInputsEdgeCount"/>
+    /// <seealso cref="DigitalInputsPeriod"/>
+    /// <seealso cref="EdgeCountEventPeriod"/>
+    /// <seealso cref="DO0PulseWidth"/>
+    /// <seealso cref="DO0LogicInputs"/>
+    /// <seealso cref="DO0LogicFunction"/>
+    /// <seealso cref="DO0LogicThreshold"/>
+    /// <seealso cref="DO0LogicResetInputs"/>
+    /// <seealso cref="DO0TriggerRisingEdge"/>
+    /// <seealso cref="DO0TriggerFallingEdge"/>
+    /// <seealso cref="DO0TriggerPatternMask"/>
+    /// <seealso cref="DO0TriggerPattern"/>
+    /// <seealso cref="DO0TriggerDelay"/>
+    /// <seealso cref="DO0TriggerRearmMode"/>
+    /// <seealso cref="DO0TriggerArm"/>
+    /// <seealso cref="DO0Pattern"/>
+    /// <seealso cref="DO0PatternRepeat"/>
+    /// <seealso cref="DO0PatternTrigger"/>
+    /// <seealso cref="DO0PatternControl"/>
+    /// <seealso cref="DigitalInputsInterruptLevel"/>
+    /// <seealso cref="CaptureLatencyMax"/>
+    /// <seealso cref="Telemetry"/>
+    /// <seealso cref="TelemetryEventPeriod"/>
     [XmlInclude(typeof(DigitalInputState))]
     [XmlInclude(typeof(DigitalOutputState))]
     [XmlInclude(typeof(DigitalInputsSamplingMode))]
     [XmlInclude(typeof(DO0Config))]
     [XmlInclude(typeof(EnableEvents))]
+    [XmlInclude(typeof(EventQueueOverflows))]
+    [XmlInclude(typeof(DigitalInputStateBatch))]
+    [XmlInclude(typeof(SamplingPeriod))]
+    [XmlInclude(typeof(SamplingEventMode))]
+    [XmlInclude(typeof(KeyframeInterval))]
+    [XmlInclude(typeof(DigitalInputsRisingEdge))]
+    [XmlInclude(typeof(DigitalInputsFallingEdge))]
+    [XmlInclude(typeof(DigitalInputsDeadTime))]
+    [XmlInclude(typeof(DigitalInputsGlitchCount))]
+    [XmlInclude(typeof(DigitalInputsEdgeCount))]
+    [XmlInclude(typeof(DigitalInputsPeriod))]
+    [XmlInclude(typeof(EdgeCountEventPeriod))]
+    [XmlInclude(typeof(DO0PulseWidth))]
+    [XmlInclude(typeof(DO0LogicInputs))]
+    [XmlInclude(typeof(DO0LogicFunction))]
+    [XmlInclude(typeof(DO0LogicThreshold))]
+    [XmlInclude(typeof(DO0LogicResetInputs))]
+    [XmlInclude(typeof(DO0TriggerRisingEdge))]
+    [XmlInclude(typeof(DO0TriggerFallingEdge))]
+    [XmlInclude(typeof(DO0TriggerPatternMask))]
+    [XmlInclude(typeof(DO0TriggerPattern))]
+    [XmlInclude(typeof(DO0TriggerDelay))]
+    [XmlInclude(typeof(DO0TriggerRearmMode))]
+    [XmlInclude(typeof(DO0TriggerArm))]
+    [XmlInclude(typeof(DO0Pattern))]
+    [XmlInclude(typeof(DO0PatternRepeat))]
+    [XmlInclude(typeof(DO0PatternTrigger))]
+    [XmlInclude(typeof(DO0PatternControl))]
+    [XmlInclude(typeof(DigitalInputsInterruptLevel))]
+    [XmlInclude(typeof(CaptureLatencyMax))]
+    [XmlInclude(typeof(Telemetry))]
+    [XmlInclude(typeof(TelemetryEventPeriod))]
     [Description("Formats a sequence of values as specific Synchronizer register messages.")]
     public partial class Format : FormatBuilder, INamedElement
     {
@@ -770,325 +1026,5375 @@ namespace Harp.Synchronizer
         }
     }
 
+    /// <summary>
+    /// Represents a register that number of digital input readings dropped because the device's event queue was full.
+    /// </summary>
+    [Description("Number of digital input readings dropped because the device's event queue was full.")]
+    public partial class EventQueueOverflows
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EventQueueOverflows"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 41;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="EventQueueOverflows"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="EventQueueOverflows"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="EventQueueOverflows"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="EventQueueOverflows"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="EventQueueOverflows"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EventQueueOverflows"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="EventQueueOverflows"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EventQueueOverflows"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// EventQueueOverflows register.
+    /// </summary>
+    /// <seealso cref="EventQueueOverflows"/>
+    [Description("Filters and selects timestamped messages from the EventQueueOverflows register.")]
+    public partial class TimestampedEventQueueOverflows
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EventQueueOverflows"/> register. This field is constant.
+        /// </summary>
+        public const int Address = EventQueueOverflows.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="EventQueueOverflows"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return EventQueueOverflows.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that batch of consecutive digital input readings. The first element is the sample period in microseconds and the message timestamp is the time of the first reading.
+    /// </summary>
+    [Description("Batch of consecutive digital input readings. The first element is the sample period in microseconds and the message timestamp is the time of the first reading.")]
+    public partial class DigitalInputStateBatch
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DigitalInputStateBatch"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 42;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DigitalInputStateBatch"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DigitalInputStateBatch"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 17;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DigitalInputStateBatch"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DigitalInputStateBatch"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DigitalInputStateBatch"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DigitalInputStateBatch"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DigitalInputStateBatch"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DigitalInputStateBatch"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DigitalInputStateBatch register.
+    /// </summary>
+    /// <seealso cref="DigitalInputStateBatch"/>
+    [Description("Filters and selects timestamped messages from the DigitalInputStateBatch register.")]
+    public partial class TimestampedDigitalInputStateBatch
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DigitalInputStateBatch"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DigitalInputStateBatch.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DigitalInputStateBatch"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return DigitalInputStateBatch.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the sample period, in microseconds, of the timer sampling modes. Valid values are between 100 and 16383.
+    /// </summary>
+    [Description("Sets the sample period, in microseconds, of the timer sampling modes. Valid values are between 100 and 16383.")]
+    public partial class SamplingPeriod
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SamplingPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 43;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SamplingPeriod"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SamplingPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SamplingPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SamplingPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SamplingPeriod"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SamplingPeriod"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SamplingPeriod"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SamplingPeriod"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SamplingPeriod register.
+    /// </summary>
+    /// <seealso cref="SamplingPeriod"/>
+    [Description("Filters and selects timestamped messages from the SamplingPeriod register.")]
+    public partial class TimestampedSamplingPeriod
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SamplingPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SamplingPeriod.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SamplingPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return SamplingPeriod.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures when the non-batched fixed-rate sampling modes emit the DigitalInputState event.
+    /// </summary>
+    [Description("Configures when the non-batched fixed-rate sampling modes emit the DigitalInputState event.")]
+    public partial class SamplingEventMode
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SamplingEventMode"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 44;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SamplingEventMode"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SamplingEventMode"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SamplingEventMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static SamplingEventConfig GetPayload(HarpMessage message)
+        {
+            return (SamplingEventConfig)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SamplingEventMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<SamplingEventConfig> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((SamplingEventConfig)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SamplingEventMode"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SamplingEventMode"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, SamplingEventConfig value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SamplingEventMode"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SamplingEventMode"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, SamplingEventConfig value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SamplingEventMode register.
+    /// </summary>
+    /// <seealso cref="SamplingEventMode"/>
+    [Description("Filters and selects timestamped messages from the SamplingEventMode register.")]
+    public partial class TimestampedSamplingEventMode
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SamplingEventMode"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SamplingEventMode.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SamplingEventMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<SamplingEventConfig> GetPayload(HarpMessage message)
+        {
+            return SamplingEventMode.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that maximum number of samples without a DigitalInputState event when only the changes are emitted. A value of 0 disables the keyframes.
+    /// </summary>
+    [Description("Maximum number of samples without a DigitalInputState event when only the changes are emitted. A value of 0 disables the keyframes.")]
+    public partial class KeyframeInterval
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="KeyframeInterval"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 45;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="KeyframeInterval"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="KeyframeInterval"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="KeyframeInterval"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="KeyframeInterval"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="KeyframeInterval"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="KeyframeInterval"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="KeyframeInterval"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="KeyframeInterval"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// KeyframeInterval register.
+    /// </summary>
+    /// <seealso cref="KeyframeInterval"/>
+    [Description("Filters and selects timestamped messages from the KeyframeInterval register.")]
+    public partial class TimestampedKeyframeInterval
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="KeyframeInterval"/> register. This field is constant.
+        /// </summary>
+        public const int Address = KeyframeInterval.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="KeyframeInterval"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return KeyframeInterval.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the digital inputs whose rising edge is caught in the edge-triggered sampling modes.
+    /// </summary>
+    [Description("Specifies the digital inputs whose rising edge is caught in the edge-triggered sampling modes.")]
+    public partial class DigitalInputsRisingEdge
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DigitalInputsRisingEdge"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 46;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DigitalInputsRisingEdge"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DigitalInputsRisingEdge"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DigitalInputsRisingEdge"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static DigitalInputs GetPayload(HarpMessage message)
+        {
+            return (DigitalInputs)message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DigitalInputsRisingEdge"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DigitalInputs> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadUInt16();
+            return Timestamped.Create((DigitalInputs)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DigitalInputsRisingEdge"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DigitalInputsRisingEdge"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, DigitalInputs value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, (ushort)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DigitalInputsRisingEdge"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DigitalInputsRisingEdge"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, DigitalInputs value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, (ushort)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DigitalInputsRisingEdge register.
+    /// </summary>
+    /// <seealso cref="DigitalInputsRisingEdge"/>
+    [Description("Filters and selects timestamped messages from the DigitalInputsRisingEdge register.")]
+    public partial class TimestampedDigitalInputsRisingEdge
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DigitalInputsRisingEdge"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DigitalInputsRisingEdge.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DigitalInputsRisingEdge"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DigitalInputs> GetPayload(HarpMessage message)
+        {
+            return DigitalInputsRisingEdge.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the digital inputs whose falling edge is caught in the edge-triggered sampling modes.
+    /// </summary>
+    [Description("Specifies the digital inputs whose falling edge is caught in the edge-triggered sampling modes.")]
+    public partial class DigitalInputsFallingEdge
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DigitalInputsFallingEdge"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 47;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DigitalInputsFallingEdge"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DigitalInputsFallingEdge"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DigitalInputsFallingEdge"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static DigitalInputs GetPayload(HarpMessage message)
+        {
+            return (DigitalInputs)message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DigitalInputsFallingEdge"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DigitalInputs> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadUInt16();
+            return Timestamped.Create((DigitalInputs)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DigitalInputsFallingEdge"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DigitalInputsFallingEdge"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, DigitalInputs value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, (ushort)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DigitalInputsFallingEdge"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DigitalInputsFallingEdge"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, DigitalInputs value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, (ushort)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DigitalInputsFallingEdge register.
+    /// </summary>
+    /// <seealso cref="DigitalInputsFallingEdge"/>
+    [Description("Filters and selects timestamped messages from the DigitalInputsFallingEdge register.")]
+    public partial class TimestampedDigitalInputsFallingEdge
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DigitalInputsFallingEdge"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DigitalInputsFallingEdge.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DigitalInputsFallingEdge"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DigitalInputs> GetPayload(HarpMessage message)
+        {
+            return DigitalInputsFallingEdge.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the dead time, in microseconds, of each digital input. The input's interrupt is disabled for this time after a change is caught, so its bounces are ignored. A value of 0 disables the filter.
+    /// </summary>
+    [Description("Sets the dead time, in microseconds, of each digital input. The input's interrupt is disabled for this time after a change is caught, so its bounces are ignored. A value of 0 disables the filter.")]
+    public partial class DigitalInputsDeadTime
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DigitalInputsDeadTime"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 48;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DigitalInputsDeadTime"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DigitalInputsDeadTime"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 9;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DigitalInputsDeadTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DigitalInputsDeadTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DigitalInputsDeadTime"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DigitalInputsDeadTime"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DigitalInputsDeadTime"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DigitalInputsDeadTime"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DigitalInputsDeadTime register.
+    /// </summary>
+    /// <seealso cref="DigitalInputsDeadTime"/>
+    [Description("Filters and selects timestamped messages from the DigitalInputsDeadTime register.")]
+    public partial class TimestampedDigitalInputsDeadTime
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DigitalInputsDeadTime"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DigitalInputsDeadTime.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DigitalInputsDeadTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return DigitalInputsDeadTime.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that number of dead times of each digital input during which the input changed. Each dead time counts at most once.
+    /// </summary>
+    [Description("Number of dead times of each digital input during which the input changed. Each dead time counts at most once.")]
+    public partial class DigitalInputsGlitchCount
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DigitalInputsGlitchCount"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 49;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DigitalInputsGlitchCount"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DigitalInputsGlitchCount"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 9;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DigitalInputsGlitchCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DigitalInputsGlitchCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DigitalInputsGlitchCount"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DigitalInputsGlitchCount"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DigitalInputsGlitchCount"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DigitalInputsGlitchCount"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DigitalInputsGlitchCount register.
+    /// </summary>
+    /// <seealso cref="DigitalInputsGlitchCount"/>
+    [Description("Filters and selects timestamped messages from the DigitalInputsGlitchCount register.")]
+    public partial class TimestampedDigitalInputsGlitchCount
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DigitalInputsGlitchCount"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DigitalInputsGlitchCount.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DigitalInputsGlitchCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return DigitalInputsGlitchCount.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that number of edges caught on each digital input in the edge-triggered sampling modes. An event will be periodically emitted with the value of all the counters.
+    /// </summary>
+    [Description("Number of edges caught on each digital input in the edge-triggered sampling modes. An event will be periodically emitted with the value of all the counters.")]
+    public partial class DigitalInputsEdgeCount
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DigitalInputsEdgeCount"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 50;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DigitalInputsEdgeCount"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DigitalInputsEdgeCount"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 9;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DigitalInputsEdgeCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DigitalInputsEdgeCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DigitalInputsEdgeCount"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DigitalInputsEdgeCount"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DigitalInputsEdgeCount"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DigitalInputsEdgeCount"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DigitalInputsEdgeCount register.
+    /// </summary>
+    /// <seealso cref="DigitalInputsEdgeCount"/>
+    [Description("Filters and selects timestamped messages from the DigitalInputsEdgeCount register.")]
+    public partial class TimestampedDigitalInputsEdgeCount
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DigitalInputsEdgeCount"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DigitalInputsEdgeCount.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DigitalInputsEdgeCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return DigitalInputsEdgeCount.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that time, in microseconds, between the last two edges of the same direction caught on each digital input. The rising edges are used unless only the falling edge is caught. Periods longer than 4294967295 microseconds (about 71.6 minutes) read as 4294967295.
+    /// </summary>
+    [Description("Time, in microseconds, between the last two edges of the same direction caught on each digital input. The rising edges are used unless only the falling edge is caught. Periods longer than 4294967295 microseconds (about 71.6 minutes) read as 4294967295.")]
+    public partial class DigitalInputsPeriod
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DigitalInputsPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 51;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DigitalInputsPeriod"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DigitalInputsPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 9;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DigitalInputsPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DigitalInputsPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DigitalInputsPeriod"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DigitalInputsPeriod"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DigitalInputsPeriod"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DigitalInputsPeriod"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DigitalInputsPeriod register.
+    /// </summary>
+    /// <seealso cref="DigitalInputsPeriod"/>
+    [Description("Filters and selects timestamped messages from the DigitalInputsPeriod register.")]
+    public partial class TimestampedDigitalInputsPeriod
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DigitalInputsPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DigitalInputsPeriod.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DigitalInputsPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return DigitalInputsPeriod.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the time, in milliseconds, between the events of the DigitalInputsEdgeCount register.
+    /// </summary>
+    [Description("Sets the time, in milliseconds, between the events of the DigitalInputsEdgeCount register.")]
+    public partial class EdgeCountEventPeriod
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EdgeCountEventPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 52;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="EdgeCountEventPeriod"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="EdgeCountEventPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="EdgeCountEventPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="EdgeCountEventPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="EdgeCountEventPeriod"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EdgeCountEventPeriod"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="EdgeCountEventPeriod"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EdgeCountEventPeriod"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// EdgeCountEventPeriod register.
+    /// </summary>
+    /// <seealso cref="EdgeCountEventPeriod"/>
+    [Description("Filters and selects timestamped messages from the EdgeCountEventPeriod register.")]
+    public partial class TimestampedEdgeCountEventPeriod
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EdgeCountEventPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int Address = EdgeCountEventPeriod.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="EdgeCountEventPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return EdgeCountEventPeriod.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the width, in microseconds, of the DO0 pulse generated by hardware on the edges of DI0 (1 to 65535). Widths above 16383 have a resolution of 2 microseconds.
+    /// </summary>
+    [Description("Sets the width, in microseconds, of the DO0 pulse generated by hardware on the edges of DI0 (1 to 65535). Widths above 16383 have a resolution of 2 microseconds.")]
+    public partial class DO0PulseWidth
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO0PulseWidth"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 53;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DO0PulseWidth"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DO0PulseWidth"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DO0PulseWidth"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DO0PulseWidth"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DO0PulseWidth"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0PulseWidth"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DO0PulseWidth"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0PulseWidth"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DO0PulseWidth register.
+    /// </summary>
+    /// <seealso cref="DO0PulseWidth"/>
+    [Description("Filters and selects timestamped messages from the DO0PulseWidth register.")]
+    public partial class TimestampedDO0PulseWidth
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO0PulseWidth"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DO0PulseWidth.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DO0PulseWidth"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return DO0PulseWidth.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the digital inputs used by the DO0 logic. The logic is evaluated on every change of these inputs and of DO0LogicResetInputs, whatever the sampling mode is.
+    /// </summary>
+    [Description("Specifies the digital inputs used by the DO0 logic. The logic is evaluated on every change of these inputs and of DO0LogicResetInputs, whatever the sampling mode is.")]
+    public partial class DO0LogicInputs
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO0LogicInputs"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 54;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DO0LogicInputs"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DO0LogicInputs"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DO0LogicInputs"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static DigitalInputs GetPayload(HarpMessage message)
+        {
+            return (DigitalInputs)message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DO0LogicInputs"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DigitalInputs> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadUInt16();
+            return Timestamped.Create((DigitalInputs)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DO0LogicInputs"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0LogicInputs"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, DigitalInputs value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, (ushort)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DO0LogicInputs"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0LogicInputs"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, DigitalInputs value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, (ushort)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DO0LogicInputs register.
+    /// </summary>
+    /// <seealso cref="DO0LogicInputs"/>
+    [Description("Filters and selects timestamped messages from the DO0LogicInputs register.")]
+    public partial class TimestampedDO0LogicInputs
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO0LogicInputs"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DO0LogicInputs.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DO0LogicInputs"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DigitalInputs> GetPayload(HarpMessage message)
+        {
+            return DO0LogicInputs.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the function of the digital inputs applied to DO0 when the Logic mode is selected.
+    /// </summary>
+    [Description("Specifies the function of the digital inputs applied to DO0 when the Logic mode is selected.")]
+    public partial class DO0LogicFunction
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO0LogicFunction"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 55;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DO0LogicFunction"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DO0LogicFunction"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DO0LogicFunction"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static DO0LogicFunctionConfig GetPayload(HarpMessage message)
+        {
+            return (DO0LogicFunctionConfig)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DO0LogicFunction"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DO0LogicFunctionConfig> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((DO0LogicFunctionConfig)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DO0LogicFunction"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0LogicFunction"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, DO0LogicFunctionConfig value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DO0LogicFunction"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0LogicFunction"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, DO0LogicFunctionConfig value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DO0LogicFunction register.
+    /// </summary>
+    /// <seealso cref="DO0LogicFunction"/>
+    [Description("Filters and selects timestamped messages from the DO0LogicFunction register.")]
+    public partial class TimestampedDO0LogicFunction
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO0LogicFunction"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DO0LogicFunction.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DO0LogicFunction"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DO0LogicFunctionConfig> GetPayload(HarpMessage message)
+        {
+            return DO0LogicFunction.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the minimum number of high digital inputs of the Threshold function (0 to 9).
+    /// </summary>
+    [Description("Sets the minimum number of high digital inputs of the Threshold function (0 to 9).")]
+    public partial class DO0LogicThreshold
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO0LogicThreshold"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 56;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DO0LogicThreshold"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DO0LogicThreshold"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DO0LogicThreshold"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DO0LogicThreshold"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DO0LogicThreshold"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0LogicThreshold"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DO0LogicThreshold"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0LogicThreshold"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DO0LogicThreshold register.
+    /// </summary>
+    /// <seealso cref="DO0LogicThreshold"/>
+    [Description("Filters and selects timestamped messages from the DO0LogicThreshold register.")]
+    public partial class TimestampedDO0LogicThreshold
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO0LogicThreshold"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DO0LogicThreshold.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DO0LogicThreshold"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return DO0LogicThreshold.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the digital inputs that reset the DO0 output when the SetReset function is selected.
+    /// </summary>
+    [Description("Specifies the digital inputs that reset the DO0 output when the SetReset function is selected.")]
+    public partial class DO0LogicResetInputs
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO0LogicResetInputs"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 57;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DO0LogicResetInputs"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DO0LogicResetInputs"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DO0LogicResetInputs"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static DigitalInputs GetPayload(HarpMessage message)
+        {
+            return (DigitalInputs)message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DO0LogicResetInputs"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DigitalInputs> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadUInt16();
+            return Timestamped.Create((DigitalInputs)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DO0LogicResetInputs"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0LogicResetInputs"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, DigitalInputs value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, (ushort)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DO0LogicResetInputs"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0LogicResetInputs"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, DigitalInputs value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, (ushort)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DO0LogicResetInputs register.
+    /// </summary>
+    /// <seealso cref="DO0LogicResetInputs"/>
+    [Description("Filters and selects timestamped messages from the DO0LogicResetInputs register.")]
+    public partial class TimestampedDO0LogicResetInputs
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO0LogicResetInputs"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DO0LogicResetInputs.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DO0LogicResetInputs"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DigitalInputs> GetPayload(HarpMessage message)
+        {
+            return DO0LogicResetInputs.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the digital inputs whose rising edge fires the DO0 trigger. The edge is detected whatever the sampling mode is.
+    /// </summary>
+    [Description("Specifies the digital inputs whose rising edge fires the DO0 trigger. The edge is detected whatever the sampling mode is.")]
+    public partial class DO0TriggerRisingEdge
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO0TriggerRisingEdge"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 58;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DO0TriggerRisingEdge"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DO0TriggerRisingEdge"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DO0TriggerRisingEdge"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static DigitalInputs GetPayload(HarpMessage message)
+        {
+            return (DigitalInputs)message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DO0TriggerRisingEdge"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DigitalInputs> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadUInt16();
+            return Timestamped.Create((DigitalInputs)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DO0TriggerRisingEdge"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0TriggerRisingEdge"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, DigitalInputs value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, (ushort)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DO0TriggerRisingEdge"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0TriggerRisingEdge"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, DigitalInputs value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, (ushort)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DO0TriggerRisingEdge register.
+    /// </summary>
+    /// <seealso cref="DO0TriggerRisingEdge"/>
+    [Description("Filters and selects timestamped messages from the DO0TriggerRisingEdge register.")]
+    public partial class TimestampedDO0TriggerRisingEdge
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO0TriggerRisingEdge"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DO0TriggerRisingEdge.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DO0TriggerRisingEdge"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DigitalInputs> GetPayload(HarpMessage message)
+        {
+            return DO0TriggerRisingEdge.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the digital inputs whose falling edge fires the DO0 trigger. The edge is detected whatever the sampling mode is.
+    /// </summary>
+    [Description("Specifies the digital inputs whose falling edge fires the DO0 trigger. The edge is detected whatever the sampling mode is.")]
+    public partial class DO0TriggerFallingEdge
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO0TriggerFallingEdge"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 59;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DO0TriggerFallingEdge"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DO0TriggerFallingEdge"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DO0TriggerFallingEdge"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static DigitalInputs GetPayload(HarpMessage message)
+        {
+            return (DigitalInputs)message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DO0TriggerFallingEdge"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DigitalInputs> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadUInt16();
+            return Timestamped.Create((DigitalInputs)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DO0TriggerFallingEdge"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0TriggerFallingEdge"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, DigitalInputs value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, (ushort)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DO0TriggerFallingEdge"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0TriggerFallingEdge"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, DigitalInputs value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, (ushort)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DO0TriggerFallingEdge register.
+    /// </summary>
+    /// <seealso cref="DO0TriggerFallingEdge"/>
+    [Description("Filters and selects timestamped messages from the DO0TriggerFallingEdge register.")]
+    public partial class TimestampedDO0TriggerFallingEdge
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO0TriggerFallingEdge"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DO0TriggerFallingEdge.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DO0TriggerFallingEdge"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DigitalInputs> GetPayload(HarpMessage message)
+        {
+            return DO0TriggerFallingEdge.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the digital inputs that must match DO0TriggerPattern when the trigger edge occurs.
+    /// </summary>
+    [Description("Specifies the digital inputs that must match DO0TriggerPattern when the trigger edge occurs.")]
+    public partial class DO0TriggerPatternMask
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO0TriggerPatternMask"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 60;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DO0TriggerPatternMask"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DO0TriggerPatternMask"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DO0TriggerPatternMask"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static DigitalInputs GetPayload(HarpMessage message)
+        {
+            return (DigitalInputs)message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DO0TriggerPatternMask"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DigitalInputs> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadUInt16();
+            return Timestamped.Create((DigitalInputs)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DO0TriggerPatternMask"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0TriggerPatternMask"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, DigitalInputs value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, (ushort)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DO0TriggerPatternMask"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0TriggerPatternMask"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, DigitalInputs value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, (ushort)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DO0TriggerPatternMask register.
+    /// </summary>
+    /// <seealso cref="DO0TriggerPatternMask"/>
+    [Description("Filters and selects timestamped messages from the DO0TriggerPatternMask register.")]
+    public partial class TimestampedDO0TriggerPatternMask
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO0TriggerPatternMask"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DO0TriggerPatternMask.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DO0TriggerPatternMask"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DigitalInputs> GetPayload(HarpMessage message)
+        {
+            return DO0TriggerPatternMask.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the state required on the digital inputs of DO0TriggerPatternMask for the trigger to fire.
+    /// </summary>
+    [Description("Specifies the state required on the digital inputs of DO0TriggerPatternMask for the trigger to fire.")]
+    public partial class DO0TriggerPattern
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO0TriggerPattern"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 61;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DO0TriggerPattern"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DO0TriggerPattern"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DO0TriggerPattern"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static DigitalInputs GetPayload(HarpMessage message)
+        {
+            return (DigitalInputs)message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DO0TriggerPattern"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DigitalInputs> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadUInt16();
+            return Timestamped.Create((DigitalInputs)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DO0TriggerPattern"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0TriggerPattern"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, DigitalInputs value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, (ushort)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DO0TriggerPattern"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0TriggerPattern"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, DigitalInputs value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, (ushort)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DO0TriggerPattern register.
+    /// </summary>
+    /// <seealso cref="DO0TriggerPattern"/>
+    [Description("Filters and selects timestamped messages from the DO0TriggerPattern register.")]
+    public partial class TimestampedDO0TriggerPattern
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO0TriggerPattern"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DO0TriggerPattern.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DO0TriggerPattern"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DigitalInputs> GetPayload(HarpMessage message)
+        {
+            return DO0TriggerPattern.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the delay, in microseconds, between the trigger and the start of the DO0 pulse. The width of the pulse is set by DO0PulseWidth. When the delay and the width add up to more than 16382, both have a resolution of 2 microseconds.
+    /// </summary>
+    [Description("Sets the delay, in microseconds, between the trigger and the start of the DO0 pulse. The width of the pulse is set by DO0PulseWidth. When the delay and the width add up to more than 16382, both have a resolution of 2 microseconds.")]
+    public partial class DO0TriggerDelay
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO0TriggerDelay"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 62;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DO0TriggerDelay"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DO0TriggerDelay"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DO0TriggerDelay"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DO0TriggerDelay"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DO0TriggerDelay"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0TriggerDelay"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DO0TriggerDelay"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0TriggerDelay"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DO0TriggerDelay register.
+    /// </summary>
+    /// <seealso cref="DO0TriggerDelay"/>
+    [Description("Filters and selects timestamped messages from the DO0TriggerDelay register.")]
+    public partial class TimestampedDO0TriggerDelay
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO0TriggerDelay"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DO0TriggerDelay.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DO0TriggerDelay"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return DO0TriggerDelay.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies when the DO0 trigger can fire again.
+    /// </summary>
+    [Description("Specifies when the DO0 trigger can fire again.")]
+    public partial class DO0TriggerRearmMode
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO0TriggerRearmMode"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 63;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DO0TriggerRearmMode"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DO0TriggerRearmMode"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DO0TriggerRearmMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static DO0TriggerRearmConfig GetPayload(HarpMessage message)
+        {
+            return (DO0TriggerRearmConfig)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DO0TriggerRearmMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DO0TriggerRearmConfig> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((DO0TriggerRearmConfig)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DO0TriggerRearmMode"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0TriggerRearmMode"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, DO0TriggerRearmConfig value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DO0TriggerRearmMode"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0TriggerRearmMode"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, DO0TriggerRearmConfig value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DO0TriggerRearmMode register.
+    /// </summary>
+    /// <seealso cref="DO0TriggerRearmMode"/>
+    [Description("Filters and selects timestamped messages from the DO0TriggerRearmMode register.")]
+    public partial class TimestampedDO0TriggerRearmMode
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO0TriggerRearmMode"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DO0TriggerRearmMode.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DO0TriggerRearmMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DO0TriggerRearmConfig> GetPayload(HarpMessage message)
+        {
+            return DO0TriggerRearmMode.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that arms (1) or disarms (0) the DO0 trigger. The trigger is armed when the Trigger mode is selected and is disarmed after firing when the Manual re-arm mode is used.
+    /// </summary>
+    [Description("Arms (1) or disarms (0) the DO0 trigger. The trigger is armed when the Trigger mode is selected and is disarmed after firing when the Manual re-arm mode is used.")]
+    public partial class DO0TriggerArm
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO0TriggerArm"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 64;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DO0TriggerArm"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DO0TriggerArm"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DO0TriggerArm"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DO0TriggerArm"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DO0TriggerArm"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0TriggerArm"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DO0TriggerArm"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0TriggerArm"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DO0TriggerArm register.
+    /// </summary>
+    /// <seealso cref="DO0TriggerArm"/>
+    [Description("Filters and selects timestamped messages from the DO0TriggerArm register.")]
+    public partial class TimestampedDO0TriggerArm
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO0TriggerArm"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DO0TriggerArm.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DO0TriggerArm"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return DO0TriggerArm.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the durations, in microseconds, of the segments played on DO0 in the Pattern mode (1 to 16383). The segments alternate between high and low, starting high, and the pattern ends at the first zero. The number of segments must be even.
+    /// </summary>
+    [Description("Sets the durations, in microseconds, of the segments played on DO0 in the Pattern mode (1 to 16383). The segments alternate between high and low, starting high, and the pattern ends at the first zero. The number of segments must be even.")]
+    public partial class DO0Pattern
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO0Pattern"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 65;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DO0Pattern"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DO0Pattern"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 32;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DO0Pattern"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DO0Pattern"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DO0Pattern"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0Pattern"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DO0Pattern"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0Pattern"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DO0Pattern register.
+    /// </summary>
+    /// <seealso cref="DO0Pattern"/>
+    [Description("Filters and selects timestamped messages from the DO0Pattern register.")]
+    public partial class TimestampedDO0Pattern
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO0Pattern"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DO0Pattern.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DO0Pattern"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return DO0Pattern.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the number of times the DO0 pattern is played. If zero, the pattern repeats until stopped.
+    /// </summary>
+    [Description("Sets the number of times the DO0 pattern is played. If zero, the pattern repeats until stopped.")]
+    public partial class DO0PatternRepeat
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO0PatternRepeat"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 66;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DO0PatternRepeat"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DO0PatternRepeat"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DO0PatternRepeat"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DO0PatternRepeat"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DO0PatternRepeat"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0PatternRepeat"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DO0PatternRepeat"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0PatternRepeat"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DO0PatternRepeat register.
+    /// </summary>
+    /// <seealso cref="DO0PatternRepeat"/>
+    [Description("Filters and selects timestamped messages from the DO0PatternRepeat register.")]
+    public partial class TimestampedDO0PatternRepeat
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO0PatternRepeat"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DO0PatternRepeat.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DO0PatternRepeat"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return DO0PatternRepeat.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that specifies the digital inputs whose rising edge starts the DO0 pattern. The edge is detected whatever the sampling mode is.
+    /// </summary>
+    [Description("Specifies the digital inputs whose rising edge starts the DO0 pattern. The edge is detected whatever the sampling mode is.")]
+    public partial class DO0PatternTrigger
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO0PatternTrigger"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 67;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DO0PatternTrigger"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DO0PatternTrigger"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DO0PatternTrigger"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static DigitalInputs GetPayload(HarpMessage message)
+        {
+            return (DigitalInputs)message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DO0PatternTrigger"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DigitalInputs> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadUInt16();
+            return Timestamped.Create((DigitalInputs)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DO0PatternTrigger"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0PatternTrigger"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, DigitalInputs value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, (ushort)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DO0PatternTrigger"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0PatternTrigger"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, DigitalInputs value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, (ushort)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DO0PatternTrigger register.
+    /// </summary>
+    /// <seealso cref="DO0PatternTrigger"/>
+    [Description("Filters and selects timestamped messages from the DO0PatternTrigger register.")]
+    public partial class TimestampedDO0PatternTrigger
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO0PatternTrigger"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DO0PatternTrigger.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DO0PatternTrigger"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DigitalInputs> GetPayload(HarpMessage message)
+        {
+            return DO0PatternTrigger.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that starts (1) or stops (0) the DO0 pattern. Reads 1 while the pattern is playing.
+    /// </summary>
+    [Description("Starts (1) or stops (0) the DO0 pattern. Reads 1 while the pattern is playing.")]
+    public partial class DO0PatternControl
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO0PatternControl"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 68;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DO0PatternControl"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DO0PatternControl"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DO0PatternControl"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DO0PatternControl"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DO0PatternControl"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0PatternControl"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DO0PatternControl"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DO0PatternControl"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DO0PatternControl register.
+    /// </summary>
+    /// <seealso cref="DO0PatternControl"/>
+    [Description("Filters and selects timestamped messages from the DO0PatternControl register.")]
+    public partial class TimestampedDO0PatternControl
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DO0PatternControl"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DO0PatternControl.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DO0PatternControl"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return DO0PatternControl.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the priority of the interrupts that latch the digital inputs. With the High priority the inputs are latched ahead of the communication with the host.
+    /// </summary>
+    [Description("Sets the priority of the interrupts that latch the digital inputs. With the High priority the inputs are latched ahead of the communication with the host.")]
+    public partial class DigitalInputsInterruptLevel
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DigitalInputsInterruptLevel"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 69;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DigitalInputsInterruptLevel"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DigitalInputsInterruptLevel"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DigitalInputsInterruptLevel"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static InterruptPriority GetPayload(HarpMessage message)
+        {
+            return (InterruptPriority)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DigitalInputsInterruptLevel"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<InterruptPriority> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((InterruptPriority)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DigitalInputsInterruptLevel"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DigitalInputsInterruptLevel"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, InterruptPriority value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DigitalInputsInterruptLevel"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DigitalInputsInterruptLevel"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, InterruptPriority value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DigitalInputsInterruptLevel register.
+    /// </summary>
+    /// <seealso cref="DigitalInputsInterruptLevel"/>
+    [Description("Filters and selects timestamped messages from the DigitalInputsInterruptLevel register.")]
+    public partial class TimestampedDigitalInputsInterruptLevel
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DigitalInputsInterruptLevel"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DigitalInputsInterruptLevel.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DigitalInputsInterruptLevel"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<InterruptPriority> GetPayload(HarpMessage message)
+        {
+            return DigitalInputsInterruptLevel.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that worst-case latency, in microseconds, observed between an edge and its latch in the InputsChangeHardwareCapture mode. Writing any value clears the measurement.
+    /// </summary>
+    [Description("Worst-case latency, in microseconds, observed between an edge and its latch in the InputsChangeHardwareCapture mode. Writing any value clears the measurement.")]
+    public partial class CaptureLatencyMax
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="CaptureLatencyMax"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 70;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="CaptureLatencyMax"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="CaptureLatencyMax"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="CaptureLatencyMax"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="CaptureLatencyMax"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="CaptureLatencyMax"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="CaptureLatencyMax"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="CaptureLatencyMax"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="CaptureLatencyMax"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// CaptureLatencyMax register.
+    /// </summary>
+    /// <seealso cref="CaptureLatencyMax"/>
+    [Description("Filters and selects timestamped messages from the CaptureLatencyMax register.")]
+    public partial class TimestampedCaptureLatencyMax
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="CaptureLatencyMax"/> register. This field is constant.
+        /// </summary>
+        public const int Address = CaptureLatencyMax.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="CaptureLatencyMax"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return CaptureLatencyMax.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that counters of the device's performance since the last write to this register. Writing any value clears the counters.
+    /// </summary>
+    [Description("Counters of the device's performance since the last write to this register. Writing any value clears the counters.")]
+    public partial class Telemetry
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Telemetry"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 71;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Telemetry"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Telemetry"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 7;
+
+        static TelemetryPayload ParsePayload(uint[] payload)
+        {
+            TelemetryPayload result;
+            result.EventsSent = payload[0];
+            result.ReadingsDropped = payload[1];
+            result.ReadingsFiltered = payload[2];
+            result.LatencyMax = payload[3];
+            result.LatencyAverage = payload[4];
+            result.LatchCyclesMax = payload[5];
+            result.LatchCyclesAverage = payload[6];
+            return result;
+        }
+
+        static uint[] FormatPayload(TelemetryPayload value)
+        {
+            uint[] result;
+            result = new uint[7];
+            result[0] = value.EventsSent;
+            result[1] = value.ReadingsDropped;
+            result[2] = value.ReadingsFiltered;
+            result[3] = value.LatencyMax;
+            result[4] = value.LatencyAverage;
+            result[5] = value.LatchCyclesMax;
+            result[6] = value.LatchCyclesAverage;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Telemetry"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static TelemetryPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<uint>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Telemetry"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<TelemetryPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<uint>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Telemetry"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Telemetry"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, TelemetryPayload value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Telemetry"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Telemetry"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, TelemetryPayload value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Telemetry register.
+    /// </summary>
+    /// <seealso cref="Telemetry"/>
+    [Description("Filters and selects timestamped messages from the Telemetry register.")]
+    public partial class TimestampedTelemetry
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Telemetry"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Telemetry.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Telemetry"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<TelemetryPayload> GetPayload(HarpMessage message)
+        {
+            return Telemetry.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the time, in milliseconds, between the events of the Telemetry register.
+    /// </summary>
+    [Description("Sets the time, in milliseconds, between the events of the Telemetry register.")]
+    public partial class TelemetryEventPeriod
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TelemetryEventPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 72;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="TelemetryEventPeriod"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="TelemetryEventPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="TelemetryEventPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="TelemetryEventPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="TelemetryEventPeriod"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TelemetryEventPeriod"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="TelemetryEventPeriod"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TelemetryEventPeriod"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// TelemetryEventPeriod register.
+    /// </summary>
+    /// <seealso cref="TelemetryEventPeriod"/>
+    [Description("Filters and selects timestamped messages from the TelemetryEventPeriod register.")]
+    public partial class TimestampedTelemetryEventPeriod
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TelemetryEventPeriod"/> register. This field is constant.
+        /// </summary>
+        public const int Address = TelemetryEventPeriod.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="TelemetryEventPeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return TelemetryEventPeriod.GetTimestampedPayload(message);
+        }
+    }
+
     /// <summary>
     /// Represents an operator which creates standard message payloads for the
     /// Synchronizer device.
     /// </summary>
-    /// <seealso cref="CreateDigitalInputStatePayload"/>
-    /// <seealso cref="CreateDigitalOutputStatePayload"/>
-    /// <seealso cref="CreateDigitalInputsSamplingModePayload"/>
-    /// <seealso cref="CreateDO0ConfigPayload"/>
-    /// <seealso cref="CreateEnableEventsPayload"/>
-    [XmlInclude(typeof(CreateDigitalInputStatePayload))]
-    [XmlInclude(typeof(CreateDigitalOutputStatePayload))]
-    [XmlInclude(typeof(CreateDigitalInputsSamplingModePayload))]
-    [XmlInclude(typeof(CreateDO0ConfigPayload))]
-    [XmlInclude(typeof(CreateEnableEventsPayload))]
-    [XmlInclude(typeof(CreateTimestampedDigitalInputStatePayload))]
-    [XmlInclude(typeof(CreateTimestampedDigitalOutputStatePayload))]
-    [XmlInclude(typeof(CreateTimestampedDigitalInputsSamplingModePayload))]
-    [XmlInclude(typeof(CreateTimestampedDO0ConfigPayload))]
-    [XmlInclude(typeof(CreateTimestampedEnableEventsPayload))]
-    [Description("Creates standard message payloads for the Synchronizer device.")]
-    public partial class CreateMessage : CreateMessageBuilder, INamedElement
+    /// <seealso cref="CreateDigitalInputStatePayload"/>
+    /// <seealso cref="CreateDigitalOutputStatePayload"/>
+    /// <seealso cref="CreateDigitalInputsSamplingModePayload"/>
+    /// <seealso cref="CreateDO0ConfigPayload"/>
+    /// <seealso cref="CreateEnableEventsPayload"/>
+    /// <seealso cref="CreateEventQueueOverflowsPayload"/>
+    /// <seealso cref="CreateDigitalInputStateBatchPayload"/>
+    /// <seealso cref="CreateSamplingPeriodPayload"/>
+    /// <seealso cref="CreateSamplingEventModePayload"/>
+    /// <seealso cref="CreateKeyframeIntervalPayload"/>
+    /// <seealso cref="CreateDigitalInputsRisingEdgePayload"/>
+    /// <seealso cref="CreateDigitalInputsFallingEdgePayload"/>
+    /// <seealso cref="CreateDigitalInputsDeadTimePayload"/>
+    /// <seealso cref="CreateDigitalInputsGlitchCountPayload"/>
+    /// <seealso cref="CreateDigitalInputsEdgeCountPayload"/>
+    /// <seealso cref="CreateDigitalInputsPeriodPayload"/>
+    /// <seealso cref="CreateEdgeCountEventPeriodPayload"/>
+    /// <seealso cref="CreateDO0PulseWidthPayload"/>
+    /// <seealso cref="CreateDO0LogicInputsPayload"/>
+    /// <seealso cref="CreateDO0LogicFunctionPayload"/>
+    /// <seealso cref="CreateDO0LogicThresholdPayload"/>
+    /// <seealso cref="CreateDO0LogicResetInputsPayload"/>
+    /// <seealso cref="CreateDO0TriggerRisingEdgePayload"/>
+    /// <seealso cref="CreateDO0TriggerFallingEdgePayload"/>
+    /// <seealso cref="CreateDO0TriggerPatternMaskPayload"/>
+    /// <seealso cref="CreateDO0TriggerPatternPayload"/>
+    /// <seealso cref="CreateDO0TriggerDelayPayload"/>
+    /// <seealso cref="CreateDO0TriggerRearmModePayload"/>
+    /// <seealso cref="CreateDO0TriggerArmPayload"/>
+    /// <seealso cref="CreateDO0PatternPayload"/>
+    /// <seealso cref="CreateDO0PatternRepeatPayload"/>
+    /// <seealso cref="CreateDO0PatternTriggerPayload"/>
+    /// <seealso cref="CreateDO0PatternControlPayload"/>
+    /// <seealso cref="CreateDigitalInputsInterruptLevelPayload"/>
+    /// <seealso cref="CreateCaptureLatencyMaxPayload"/>
+    /// <seealso cref="CreateTelemetryPayload"/>
+    /// <seealso cref="CreateTelemetryEventPeriodPayload"/>
+    [XmlInclude(typeof(CreateDigitalInputStatePayload))]
+    [XmlInclude(typeof(CreateDigitalOutputStatePayload))]
+    [XmlInclude(typeof(CreateDigitalInputsSamplingModePayload))]
+    [XmlInclude(typeof(CreateDO0ConfigPayload))]
+    [XmlInclude(typeof(CreateEnableEventsPayload))]
+    [XmlInclude(typeof(CreateEventQueueOverflowsPayload))]
+    [XmlInclude(typeof(CreateDigitalInputStateBatchPayload))]
+    [XmlInclude(typeof(CreateSamplingPeriodPayload))]
+    [XmlInclude(typeof(CreateSamplingEventModePayload))]
+    [XmlInclude(typeof(CreateKeyframeIntervalPayload))]
+    [XmlInclude(typeof(CreateDigitalInputsRisingEdgePayload))]
+    [XmlInclude(typeof(CreateDigitalInputsFallingEdgePayload))]
+    [XmlInclude(typeof(CreateDigitalInputsDeadTimePayload))]
+    [XmlInclude(typeof(CreateDigitalInputsGlitchCountPayload))]
+    [XmlInclude(typeof(CreateDigitalInputsEdgeCountPayload))]
+    [XmlInclude(typeof(CreateDigitalInputsPeriodPayload))]
+    [XmlInclude(typeof(CreateEdgeCountEventPeriodPayload))]
+    [XmlInclude(typeof(CreateDO0PulseWidthPayload))]
+    [XmlInclude(typeof(CreateDO0LogicInputsPayload))]
+    [XmlInclude(typeof(CreateDO0LogicFunctionPayload))]
+    [XmlInclude(typeof(CreateDO0LogicThresholdPayload))]
+    [XmlInclude(typeof(CreateDO0LogicResetInputsPayload))]
+    [XmlInclude(typeof(CreateDO0TriggerRisingEdgePayload))]
+    [XmlInclude(typeof(CreateDO0TriggerFallingEdgePayload))]
+    [XmlInclude(typeof(CreateDO0TriggerPatternMaskPayload))]
+    [XmlInclude(typeof(CreateDO0TriggerPatternPayload))]
+    [XmlInclude(typeof(CreateDO0TriggerDelayPayload))]
+    [XmlInclude(typeof(CreateDO0TriggerRearmModePayload))]
+    [XmlInclude(typeof(CreateDO0TriggerArmPayload))]
+    [XmlInclude(typeof(CreateDO0PatternPayload))]
+    [XmlInclude(typeof(CreateDO0PatternRepeatPayload))]
+    [XmlInclude(typeof(CreateDO0PatternTriggerPayload))]
+    [XmlInclude(typeof(CreateDO0PatternControlPayload))]
+    [XmlInclude(typeof(CreateDigitalInputsInterruptLevelPayload))]
+    [XmlInclude(typeof(CreateCaptureLatencyMaxPayload))]
+    [XmlInclude(typeof(CreateTelemetryPayload))]
+    [XmlInclude(typeof(CreateTelemetryEventPeriodPayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalInputStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalOutputStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalInputsSamplingModePayload))]
+    [XmlInclude(typeof(CreateTimestampedDO0ConfigPayload))]
+    [XmlInclude(typeof(CreateTimestampedEnableEventsPayload))]
+    [XmlInclude(typeof(CreateTimestampedEventQueueOverflowsPayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalInputStateBatchPayload))]
+    [XmlInclude(typeof(CreateTimestampedSamplingPeriodPayload))]
+    [XmlInclude(typeof(CreateTimestampedSamplingEventModePayload))]
+    [XmlInclude(typeof(CreateTimestampedKeyframeIntervalPayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalInputsRisingEdgePayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalInputsFallingEdgePayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalInputsDeadTimePayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalInputsGlitchCountPayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalInputsEdgeCountPayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalInputsPeriodPayload))]
+    [XmlInclude(typeof(CreateTimestampedEdgeCountEventPeriodPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO0PulseWidthPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO0LogicInputsPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO0LogicFunctionPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO0LogicThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO0LogicResetInputsPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO0TriggerRisingEdgePayload))]
+    [XmlInclude(typeof(CreateTimestampedDO0TriggerFallingEdgePayload))]
+    [XmlInclude(typeof(CreateTimestampedDO0TriggerPatternMaskPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO0TriggerPatternPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO0TriggerDelayPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO0TriggerRearmModePayload))]
+    [XmlInclude(typeof(CreateTimestampedDO0TriggerArmPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO0PatternPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO0PatternRepeatPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO0PatternTriggerPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO0PatternControlPayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalInputsInterruptLevelPayload))]
+    [XmlInclude(typeof(CreateTimestampedCaptureLatencyMaxPayload))]
+    [XmlInclude(typeof(CreateTimestampedTelemetryPayload))]
+    [XmlInclude(typeof(CreateTimestampedTelemetryEventPeriodPayload))]
+    [Description("Creates standard message payloads for the Synchronizer device.")]
+    public partial class CreateMessage : CreateMessageBuilder, INamedElement
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="CreateMessage"/> class.
+        /// </summary>
+        public CreateMessage()
+        {
+            Payload = new CreateDigitalInputStatePayload();
+        }
+
+        string INamedElement.Name => $"{nameof(Synchronizer)}.{GetElementDisplayName(Payload)}";
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that state of the digital input pins. An event will be emitted when the value of any digital input pin changes.
+    /// </summary>
+    [DisplayName("DigitalInputStatePayload")]
+    [Description("Creates a message payload that state of the digital input pins. An event will be emitted when the value of any digital input pin changes.")]
+    public partial class CreateDigitalInputStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that state of the digital input pins. An event will be emitted when the value of any digital input pin changes.
+        /// </summary>
+        [Description("The value that state of the digital input pins. An event will be emitted when the value of any digital input pin changes.")]
+        public DigitalInputs DigitalInputState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalInputState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalInputs GetPayload()
+        {
+            return DigitalInputState;
+        }
+
+        /// <summary>
+        /// Creates a message that state of the digital input pins. An event will be emitted when the value of any digital input pin changes.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DigitalInputState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Synchronizer.DigitalInputState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that state of the digital input pins. An event will be emitted when the value of any digital input pin changes.
+    /// </summary>
+    [DisplayName("TimestampedDigitalInputStatePayload")]
+    [Description("Creates a timestamped message payload that state of the digital input pins. An event will be emitted when the value of any digital input pin changes.")]
+    public partial class CreateTimestampedDigitalInputStatePayload : CreateDigitalInputStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that state of the digital input pins. An event will be emitted when the value of any digital input pin changes.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DigitalInputState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Synchronizer.DigitalInputState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that status of the digital output pin 0.
+    /// </summary>
+    [DisplayName("DigitalOutputStatePayload")]
+    [Description("Creates a message payload that status of the digital output pin 0.")]
+    public partial class CreateDigitalOutputStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that status of the digital output pin 0.
+        /// </summary>
+        [Description("The value that status of the digital output pin 0.")]
+        public DigitalOutputs DigitalOutputState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalOutputState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalOutputs GetPayload()
+        {
+            return DigitalOutputState;
+        }
+
+        /// <summary>
+        /// Creates a message that status of the digital output pin 0.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DigitalOutputState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Synchronizer.DigitalOutputState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that status of the digital output pin 0.
+    /// </summary>
+    [DisplayName("TimestampedDigitalOutputStatePayload")]
+    [Description("Creates a timestamped message payload that status of the digital output pin 0.")]
+    public partial class CreateTimestampedDigitalOutputStatePayload : CreateDigitalOutputStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that status of the digital output pin 0.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DigitalOutputState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Synchronizer.DigitalOutputState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the sampling mode for digital input pins.
+    /// </summary>
+    [DisplayName("DigitalInputsSamplingModePayload")]
+    [Description("Creates a message payload that sets the sampling mode for digital input pins.")]
+    public partial class CreateDigitalInputsSamplingModePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the sampling mode for digital input pins.
+        /// </summary>
+        [Description("The value that sets the sampling mode for digital input pins.")]
+        public DigitalInputsSamplingConfig DigitalInputsSamplingMode { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalInputsSamplingMode register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalInputsSamplingConfig GetPayload()
+        {
+            return DigitalInputsSamplingMode;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the sampling mode for digital input pins.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DigitalInputsSamplingMode register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Synchronizer.DigitalInputsSamplingMode.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the sampling mode for digital input pins.
+    /// </summary>
+    [DisplayName("TimestampedDigitalInputsSamplingModePayload")]
+    [Description("Creates a timestamped message payload that sets the sampling mode for digital input pins.")]
+    public partial class CreateTimestampedDigitalInputsSamplingModePayload : CreateDigitalInputsSamplingModePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the sampling mode for digital input pins.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DigitalInputsSamplingMode register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Synchronizer.DigitalInputsSamplingMode.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures how the DO0 pin behaves.
+    /// </summary>
+    [DisplayName("DO0ConfigPayload")]
+    [Description("Creates a message payload that configures how the DO0 pin behaves.")]
+    public partial class CreateDO0ConfigPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures how the DO0 pin behaves.
+        /// </summary>
+        [Description("The value that configures how the DO0 pin behaves.")]
+        public DO0ConfigMode DO0Config { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO0Config register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DO0ConfigMode GetPayload()
+        {
+            return DO0Config;
+        }
+
+        /// <summary>
+        /// Creates a message that configures how the DO0 pin behaves.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO0Config register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Synchronizer.DO0Config.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures how the DO0 pin behaves.
+    /// </summary>
+    [DisplayName("TimestampedDO0ConfigPayload")]
+    [Description("Creates a timestamped message payload that configures how the DO0 pin behaves.")]
+    public partial class CreateTimestampedDO0ConfigPayload : CreateDO0ConfigPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures how the DO0 pin behaves.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO0Config register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Synchronizer.DO0Config.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies all the active events in the device.
+    /// </summary>
+    [DisplayName("EnableEventsPayload")]
+    [Description("Creates a message payload that specifies all the active events in the device.")]
+    public partial class CreateEnableEventsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that specifies all the active events in the device.
+        /// </summary>
+        [Description("The value that specifies all the active events in the device.")]
+        public SynchronizerEvents EnableEvents { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the EnableEvents register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public SynchronizerEvents GetPayload()
+        {
+            return EnableEvents;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies all the active events in the device.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the EnableEvents register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Synchronizer.EnableEvents.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies all the active events in the device.
+    /// </summary>
+    [DisplayName("TimestampedEnableEventsPayload")]
+    [Description("Creates a timestamped message payload that specifies all the active events in the device.")]
+    public partial class CreateTimestampedEnableEventsPayload : CreateEnableEventsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies all the active events in the device.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the EnableEvents register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Synchronizer.EnableEvents.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that number of digital input readings dropped because the device's event queue was full.
+    /// </summary>
+    [DisplayName("EventQueueOverflowsPayload")]
+    [Description("Creates a message payload that number of digital input readings dropped because the device's event queue was full.")]
+    public partial class CreateEventQueueOverflowsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that number of digital input readings dropped because the device's event queue was full.
+        /// </summary>
+        [Description("The value that number of digital input readings dropped because the device's event queue was full.")]
+        public ushort EventQueueOverflows { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the EventQueueOverflows register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return EventQueueOverflows;
+        }
+
+        /// <summary>
+        /// Creates a message that number of digital input readings dropped because the device's event queue was full.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the EventQueueOverflows register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Synchronizer.EventQueueOverflows.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that number of digital input readings dropped because the device's event queue was full.
+    /// </summary>
+    [DisplayName("TimestampedEventQueueOverflowsPayload")]
+    [Description("Creates a timestamped message payload that number of digital input readings dropped because the device's event queue was full.")]
+    public partial class CreateTimestampedEventQueueOverflowsPayload : CreateEventQueueOverflowsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that number of digital input readings dropped because the device's event queue was full.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the EventQueueOverflows register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Synchronizer.EventQueueOverflows.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that batch of consecutive digital input readings. The first element is the sample period in microseconds and the message timestamp is the time of the first reading.
+    /// </summary>
+    [DisplayName("DigitalInputStateBatchPayload")]
+    [Description("Creates a message payload that batch of consecutive digital input readings. The first element is the sample period in microseconds and the message timestamp is the time of the first reading.")]
+    public partial class CreateDigitalInputStateBatchPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that batch of consecutive digital input readings. The first element is the sample period in microseconds and the message timestamp is the time of the first reading.
+        /// </summary>
+        [Description("The value that batch of consecutive digital input readings. The first element is the sample period in microseconds and the message timestamp is the time of the first reading.")]
+        public ushort[] DigitalInputStateBatch { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalInputStateBatch register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort[] GetPayload()
+        {
+            return DigitalInputStateBatch;
+        }
+
+        /// <summary>
+        /// Creates a message that batch of consecutive digital input readings. The first element is the sample period in microseconds and the message timestamp is the time of the first reading.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DigitalInputStateBatch register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Synchronizer.DigitalInputStateBatch.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that batch of consecutive digital input readings. The first element is the sample period in microseconds and the message timestamp is the time of the first reading.
+    /// </summary>
+    [DisplayName("TimestampedDigitalInputStateBatchPayload")]
+    [Description("Creates a timestamped message payload that batch of consecutive digital input readings. The first element is the sample period in microseconds and the message timestamp is the time of the first reading.")]
+    public partial class CreateTimestampedDigitalInputStateBatchPayload : CreateDigitalInputStateBatchPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that batch of consecutive digital input readings. The first element is the sample period in microseconds and the message timestamp is the time of the first reading.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DigitalInputStateBatch register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Synchronizer.DigitalInputStateBatch.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the sample period, in microseconds, of the timer sampling modes. Valid values are between 100 and 16383.
+    /// </summary>
+    [DisplayName("SamplingPeriodPayload")]
+    [Description("Creates a message payload that sets the sample period, in microseconds, of the timer sampling modes. Valid values are between 100 and 16383.")]
+    public partial class CreateSamplingPeriodPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the sample period, in microseconds, of the timer sampling modes. Valid values are between 100 and 16383.
+        /// </summary>
+        [Description("The value that sets the sample period, in microseconds, of the timer sampling modes. Valid values are between 100 and 16383.")]
+        public ushort SamplingPeriod { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SamplingPeriod register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return SamplingPeriod;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the sample period, in microseconds, of the timer sampling modes. Valid values are between 100 and 16383.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SamplingPeriod register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Synchronizer.SamplingPeriod.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the sample period, in microseconds, of the timer sampling modes. Valid values are between 100 and 16383.
+    /// </summary>
+    [DisplayName("TimestampedSamplingPeriodPayload")]
+    [Description("Creates a timestamped message payload that sets the sample period, in microseconds, of the timer sampling modes. Valid values are between 100 and 16383.")]
+    public partial class CreateTimestampedSamplingPeriodPayload : CreateSamplingPeriodPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the sample period, in microseconds, of the timer sampling modes. Valid values are between 100 and 16383.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SamplingPeriod register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Synchronizer.SamplingPeriod.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures when the non-batched fixed-rate sampling modes emit the DigitalInputState event.
+    /// </summary>
+    [DisplayName("SamplingEventModePayload")]
+    [Description("Creates a message payload that configures when the non-batched fixed-rate sampling modes emit the DigitalInputState event.")]
+    public partial class CreateSamplingEventModePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures when the non-batched fixed-rate sampling modes emit the DigitalInputState event.
+        /// </summary>
+        [Description("The value that configures when the non-batched fixed-rate sampling modes emit the DigitalInputState event.")]
+        public SamplingEventConfig SamplingEventMode { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SamplingEventMode register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public SamplingEventConfig GetPayload()
+        {
+            return SamplingEventMode;
+        }
+
+        /// <summary>
+        /// Creates a message that configures when the non-batched fixed-rate sampling modes emit the DigitalInputState event.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SamplingEventMode register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Synchronizer.SamplingEventMode.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures when the non-batched fixed-rate sampling modes emit the DigitalInputState event.
+    /// </summary>
+    [DisplayName("TimestampedSamplingEventModePayload")]
+    [Description("Creates a timestamped message payload that configures when the non-batched fixed-rate sampling modes emit the DigitalInputState event.")]
+    public partial class CreateTimestampedSamplingEventModePayload : CreateSamplingEventModePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures when the non-batched fixed-rate sampling modes emit the DigitalInputState event.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SamplingEventMode register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Synchronizer.SamplingEventMode.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that maximum number of samples without a DigitalInputState event when only the changes are emitted. A value of 0 disables the keyframes.
+    /// </summary>
+    [DisplayName("KeyframeIntervalPayload")]
+    [Description("Creates a message payload that maximum number of samples without a DigitalInputState event when only the changes are emitted. A value of 0 disables the keyframes.")]
+    public partial class CreateKeyframeIntervalPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that maximum number of samples without a DigitalInputState event when only the changes are emitted. A value of 0 disables the keyframes.
+        /// </summary>
+        [Description("The value that maximum number of samples without a DigitalInputState event when only the changes are emitted. A value of 0 disables the keyframes.")]
+        public ushort KeyframeInterval { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the KeyframeInterval register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return KeyframeInterval;
+        }
+
+        /// <summary>
+        /// Creates a message that maximum number of samples without a DigitalInputState event when only the changes are emitted. A value of 0 disables the keyframes.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the KeyframeInterval register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Synchronizer.KeyframeInterval.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that maximum number of samples without a DigitalInputState event when only the changes are emitted. A value of 0 disables the keyframes.
+    /// </summary>
+    [DisplayName("TimestampedKeyframeIntervalPayload")]
+    [Description("Creates a timestamped message payload that maximum number of samples without a DigitalInputState event when only the changes are emitted. A value of 0 disables the keyframes.")]
+    public partial class CreateTimestampedKeyframeIntervalPayload : CreateKeyframeIntervalPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that maximum number of samples without a DigitalInputState event when only the changes are emitted. A value of 0 disables the keyframes.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the KeyframeInterval register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Synchronizer.KeyframeInterval.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the digital inputs whose rising edge is caught in the edge-triggered sampling modes.
+    /// </summary>
+    [DisplayName("DigitalInputsRisingEdgePayload")]
+    [Description("Creates a message payload that specifies the digital inputs whose rising edge is caught in the edge-triggered sampling modes.")]
+    public partial class CreateDigitalInputsRisingEdgePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that specifies the digital inputs whose rising edge is caught in the edge-triggered sampling modes.
+        /// </summary>
+        [Description("The value that specifies the digital inputs whose rising edge is caught in the edge-triggered sampling modes.")]
+        public DigitalInputs DigitalInputsRisingEdge { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalInputsRisingEdge register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalInputs GetPayload()
+        {
+            return DigitalInputsRisingEdge;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the digital inputs whose rising edge is caught in the edge-triggered sampling modes.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DigitalInputsRisingEdge register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Synchronizer.DigitalInputsRisingEdge.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the digital inputs whose rising edge is caught in the edge-triggered sampling modes.
+    /// </summary>
+    [DisplayName("TimestampedDigitalInputsRisingEdgePayload")]
+    [Description("Creates a timestamped message payload that specifies the digital inputs whose rising edge is caught in the edge-triggered sampling modes.")]
+    public partial class CreateTimestampedDigitalInputsRisingEdgePayload : CreateDigitalInputsRisingEdgePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the digital inputs whose rising edge is caught in the edge-triggered sampling modes.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DigitalInputsRisingEdge register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Synchronizer.DigitalInputsRisingEdge.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the digital inputs whose falling edge is caught in the edge-triggered sampling modes.
+    /// </summary>
+    [DisplayName("DigitalInputsFallingEdgePayload")]
+    [Description("Creates a message payload that specifies the digital inputs whose falling edge is caught in the edge-triggered sampling modes.")]
+    public partial class CreateDigitalInputsFallingEdgePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that specifies the digital inputs whose falling edge is caught in the edge-triggered sampling modes.
+        /// </summary>
+        [Description("The value that specifies the digital inputs whose falling edge is caught in the edge-triggered sampling modes.")]
+        public DigitalInputs DigitalInputsFallingEdge { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalInputsFallingEdge register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalInputs GetPayload()
+        {
+            return DigitalInputsFallingEdge;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the digital inputs whose falling edge is caught in the edge-triggered sampling modes.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DigitalInputsFallingEdge register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Synchronizer.DigitalInputsFallingEdge.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the digital inputs whose falling edge is caught in the edge-triggered sampling modes.
+    /// </summary>
+    [DisplayName("TimestampedDigitalInputsFallingEdgePayload")]
+    [Description("Creates a timestamped message payload that specifies the digital inputs whose falling edge is caught in the edge-triggered sampling modes.")]
+    public partial class CreateTimestampedDigitalInputsFallingEdgePayload : CreateDigitalInputsFallingEdgePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the digital inputs whose falling edge is caught in the edge-triggered sampling modes.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DigitalInputsFallingEdge register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Synchronizer.DigitalInputsFallingEdge.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the dead time, in microseconds, of each digital input. The input's interrupt is disabled for this time after a change is caught, so its bounces are ignored. A value of 0 disables the filter.
+    /// </summary>
+    [DisplayName("DigitalInputsDeadTimePayload")]
+    [Description("Creates a message payload that sets the dead time, in microseconds, of each digital input. The input's interrupt is disabled for this time after a change is caught, so its bounces are ignored. A value of 0 disables the filter.")]
+    public partial class CreateDigitalInputsDeadTimePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the dead time, in microseconds, of each digital input. The input's interrupt is disabled for this time after a change is caught, so its bounces are ignored. A value of 0 disables the filter.
+        /// </summary>
+        [Description("The value that sets the dead time, in microseconds, of each digital input. The input's interrupt is disabled for this time after a change is caught, so its bounces are ignored. A value of 0 disables the filter.")]
+        public ushort[] DigitalInputsDeadTime { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalInputsDeadTime register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort[] GetPayload()
+        {
+            return DigitalInputsDeadTime;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the dead time, in microseconds, of each digital input. The input's interrupt is disabled for this time after a change is caught, so its bounces are ignored. A value of 0 disables the filter.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DigitalInputsDeadTime register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Synchronizer.DigitalInputsDeadTime.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the dead time, in microseconds, of each digital input. The input's interrupt is disabled for this time after a change is caught, so its bounces are ignored. A value of 0 disables the filter.
+    /// </summary>
+    [DisplayName("TimestampedDigitalInputsDeadTimePayload")]
+    [Description("Creates a timestamped message payload that sets the dead time, in microseconds, of each digital input. The input's interrupt is disabled for this time after a change is caught, so its bounces are ignored. A value of 0 disables the filter.")]
+    public partial class CreateTimestampedDigitalInputsDeadTimePayload : CreateDigitalInputsDeadTimePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the dead time, in microseconds, of each digital input. The input's interrupt is disabled for this time after a change is caught, so its bounces are ignored. A value of 0 disables the filter.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DigitalInputsDeadTime register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Synchronizer.DigitalInputsDeadTime.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that number of dead times of each digital input during which the input changed. Each dead time counts at most once.
+    /// </summary>
+    [DisplayName("DigitalInputsGlitchCountPayload")]
+    [Description("Creates a message payload that number of dead times of each digital input during which the input changed. Each dead time counts at most once.")]
+    public partial class CreateDigitalInputsGlitchCountPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that number of dead times of each digital input during which the input changed. Each dead time counts at most once.
+        /// </summary>
+        [Description("The value that number of dead times of each digital input during which the input changed. Each dead time counts at most once.")]
+        public ushort[] DigitalInputsGlitchCount { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalInputsGlitchCount register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort[] GetPayload()
+        {
+            return DigitalInputsGlitchCount;
+        }
+
+        /// <summary>
+        /// Creates a message that number of dead times of each digital input during which the input changed. Each dead time counts at most once.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DigitalInputsGlitchCount register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Synchronizer.DigitalInputsGlitchCount.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that number of dead times of each digital input during which the input changed. Each dead time counts at most once.
+    /// </summary>
+    [DisplayName("TimestampedDigitalInputsGlitchCountPayload")]
+    [Description("Creates a timestamped message payload that number of dead times of each digital input during which the input changed. Each dead time counts at most once.")]
+    public partial class CreateTimestampedDigitalInputsGlitchCountPayload : CreateDigitalInputsGlitchCountPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that number of dead times of each digital input during which the input changed. Each dead time counts at most once.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DigitalInputsGlitchCount register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Synchronizer.DigitalInputsGlitchCount.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that number of edges caught on each digital input in the edge-triggered sampling modes. An event will be periodically emitted with the value of all the counters.
+    /// </summary>
+    [DisplayName("DigitalInputsEdgeCountPayload")]
+    [Description("Creates a message payload that number of edges caught on each digital input in the edge-triggered sampling modes. An event will be periodically emitted with the value of all the counters.")]
+    public partial class CreateDigitalInputsEdgeCountPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that number of edges caught on each digital input in the edge-triggered sampling modes. An event will be periodically emitted with the value of all the counters.
+        /// </summary>
+        [Description("The value that number of edges caught on each digital input in the edge-triggered sampling modes. An event will be periodically emitted with the value of all the counters.")]
+        public uint[] DigitalInputsEdgeCount { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalInputsEdgeCount register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint[] GetPayload()
+        {
+            return DigitalInputsEdgeCount;
+        }
+
+        /// <summary>
+        /// Creates a message that number of edges caught on each digital input in the edge-triggered sampling modes. An event will be periodically emitted with the value of all the counters.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DigitalInputsEdgeCount register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Synchronizer.DigitalInputsEdgeCount.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that number of edges caught on each digital input in the edge-triggered sampling modes. An event will be periodically emitted with the value of all the counters.
+    /// </summary>
+    [DisplayName("TimestampedDigitalInputsEdgeCountPayload")]
+    [Description("Creates a timestamped message payload that number of edges caught on each digital input in the edge-triggered sampling modes. An event will be periodically emitted with the value of all the counters.")]
+    public partial class CreateTimestampedDigitalInputsEdgeCountPayload : CreateDigitalInputsEdgeCountPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that number of edges caught on each digital input in the edge-triggered sampling modes. An event will be periodically emitted with the value of all the counters.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DigitalInputsEdgeCount register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Synchronizer.DigitalInputsEdgeCount.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that time, in microseconds, between the last two edges of the same direction caught on each digital input. The rising edges are used unless only the falling edge is caught. Periods longer than 4294967295 microseconds (about 71.6 minutes) read as 4294967295.
+    /// </summary>
+    [DisplayName("DigitalInputsPeriodPayload")]
+    [Description("Creates a message payload that time, in microseconds, between the last two edges of the same direction caught on each digital input. The rising edges are used unless only the falling edge is caught. Periods longer than 4294967295 microseconds (about 71.6 minutes) read as 4294967295.")]
+    public partial class CreateDigitalInputsPeriodPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that time, in microseconds, between the last two edges of the same direction caught on each digital input. The rising edges are used unless only the falling edge is caught. Periods longer than 4294967295 microseconds (about 71.6 minutes) read as 4294967295.
+        /// </summary>
+        [Description("The value that time, in microseconds, between the last two edges of the same direction caught on each digital input. The rising edges are used unless only the falling edge is caught. Periods longer than 4294967295 microseconds (about 71.6 minutes) read as 4294967295.")]
+        public uint[] DigitalInputsPeriod { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalInputsPeriod register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint[] GetPayload()
+        {
+            return DigitalInputsPeriod;
+        }
+
+        /// <summary>
+        /// Creates a message that time, in microseconds, between the last two edges of the same direction caught on each digital input. The rising edges are used unless only the falling edge is caught. Periods longer than 4294967295 microseconds (about 71.6 minutes) read as 4294967295.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DigitalInputsPeriod register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Synchronizer.DigitalInputsPeriod.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that time, in microseconds, between the last two edges of the same direction caught on each digital input. The rising edges are used unless only the falling edge is caught. Periods longer than 4294967295 microseconds (about 71.6 minutes) read as 4294967295.
+    /// </summary>
+    [DisplayName("TimestampedDigitalInputsPeriodPayload")]
+    [Description("Creates a timestamped message payload that time, in microseconds, between the last two edges of the same direction caught on each digital input. The rising edges are used unless only the falling edge is caught. Periods longer than 4294967295 microseconds (about 71.6 minutes) read as 4294967295.")]
+    public partial class CreateTimestampedDigitalInputsPeriodPayload : CreateDigitalInputsPeriodPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that time, in microseconds, between the last two edges of the same direction caught on each digital input. The rising edges are used unless only the falling edge is caught. Periods longer than 4294967295 microseconds (about 71.6 minutes) read as 4294967295.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DigitalInputsPeriod register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Synchronizer.DigitalInputsPeriod.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the time, in milliseconds, between the events of the DigitalInputsEdgeCount register.
+    /// </summary>
+    [DisplayName("EdgeCountEventPeriodPayload")]
+    [Description("Creates a message payload that sets the time, in milliseconds, between the events of the DigitalInputsEdgeCount register.")]
+    public partial class CreateEdgeCountEventPeriodPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the time, in milliseconds, between the events of the DigitalInputsEdgeCount register.
+        /// </summary>
+        [Description("The value that sets the time, in milliseconds, between the events of the DigitalInputsEdgeCount register.")]
+        public ushort EdgeCountEventPeriod { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the EdgeCountEventPeriod register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return EdgeCountEventPeriod;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the time, in milliseconds, between the events of the DigitalInputsEdgeCount register.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the EdgeCountEventPeriod register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Synchronizer.EdgeCountEventPeriod.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the time, in milliseconds, between the events of the DigitalInputsEdgeCount register.
+    /// </summary>
+    [DisplayName("TimestampedEdgeCountEventPeriodPayload")]
+    [Description("Creates a timestamped message payload that sets the time, in milliseconds, between the events of the DigitalInputsEdgeCount register.")]
+    public partial class CreateTimestampedEdgeCountEventPeriodPayload : CreateEdgeCountEventPeriodPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the time, in milliseconds, between the events of the DigitalInputsEdgeCount register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the EdgeCountEventPeriod register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Synchronizer.EdgeCountEventPeriod.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the width, in microseconds, of the DO0 pulse generated by hardware on the edges of DI0 (1 to 65535). Widths above 16383 have a resolution of 2 microseconds.
+    /// </summary>
+    [DisplayName("DO0PulseWidthPayload")]
+    [Description("Creates a message payload that sets the width, in microseconds, of the DO0 pulse generated by hardware on the edges of DI0 (1 to 65535). Widths above 16383 have a resolution of 2 microseconds.")]
+    public partial class CreateDO0PulseWidthPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the width, in microseconds, of the DO0 pulse generated by hardware on the edges of DI0 (1 to 65535). Widths above 16383 have a resolution of 2 microseconds.
+        /// </summary>
+        [Description("The value that sets the width, in microseconds, of the DO0 pulse generated by hardware on the edges of DI0 (1 to 65535). Widths above 16383 have a resolution of 2 microseconds.")]
+        public ushort DO0PulseWidth { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO0PulseWidth register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return DO0PulseWidth;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the width, in microseconds, of the DO0 pulse generated by hardware on the edges of DI0 (1 to 65535). Widths above 16383 have a resolution of 2 microseconds.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO0PulseWidth register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Synchronizer.DO0PulseWidth.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the width, in microseconds, of the DO0 pulse generated by hardware on the edges of DI0 (1 to 65535). Widths above 16383 have a resolution of 2 microseconds.
+    /// </summary>
+    [DisplayName("TimestampedDO0PulseWidthPayload")]
+    [Description("Creates a timestamped message payload that sets the width, in microseconds, of the DO0 pulse generated by hardware on the edges of DI0 (1 to 65535). Widths above 16383 have a resolution of 2 microseconds.")]
+    public partial class CreateTimestampedDO0PulseWidthPayload : CreateDO0PulseWidthPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the width, in microseconds, of the DO0 pulse generated by hardware on the edges of DI0 (1 to 65535). Widths above 16383 have a resolution of 2 microseconds.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO0PulseWidth register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Synchronizer.DO0PulseWidth.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the digital inputs used by the DO0 logic. The logic is evaluated on every change of these inputs and of DO0LogicResetInputs, whatever the sampling mode is.
+    /// </summary>
+    [DisplayName("DO0LogicInputsPayload")]
+    [Description("Creates a message payload that specifies the digital inputs used by the DO0 logic. The logic is evaluated on every change of these inputs and of DO0LogicResetInputs, whatever the sampling mode is.")]
+    public partial class CreateDO0LogicInputsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that specifies the digital inputs used by the DO0 logic. The logic is evaluated on every change of these inputs and of DO0LogicResetInputs, whatever the sampling mode is.
+        /// </summary>
+        [Description("The value that specifies the digital inputs used by the DO0 logic. The logic is evaluated on every change of these inputs and of DO0LogicResetInputs, whatever the sampling mode is.")]
+        public DigitalInputs DO0LogicInputs { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO0LogicInputs register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalInputs GetPayload()
+        {
+            return DO0LogicInputs;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the digital inputs used by the DO0 logic. The logic is evaluated on every change of these inputs and of DO0LogicResetInputs, whatever the sampling mode is.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO0LogicInputs register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Synchronizer.DO0LogicInputs.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the digital inputs used by the DO0 logic. The logic is evaluated on every change of these inputs and of DO0LogicResetInputs, whatever the sampling mode is.
+    /// </summary>
+    [DisplayName("TimestampedDO0LogicInputsPayload")]
+    [Description("Creates a timestamped message payload that specifies the digital inputs used by the DO0 logic. The logic is evaluated on every change of these inputs and of DO0LogicResetInputs, whatever the sampling mode is.")]
+    public partial class CreateTimestampedDO0LogicInputsPayload : CreateDO0LogicInputsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the digital inputs used by the DO0 logic. The logic is evaluated on every change of these inputs and of DO0LogicResetInputs, whatever the sampling mode is.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO0LogicInputs register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Synchronizer.DO0LogicInputs.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the function of the digital inputs applied to DO0 when the Logic mode is selected.
+    /// </summary>
+    [DisplayName("DO0LogicFunctionPayload")]
+    [Description("Creates a message payload that specifies the function of the digital inputs applied to DO0 when the Logic mode is selected.")]
+    public partial class CreateDO0LogicFunctionPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that specifies the function of the digital inputs applied to DO0 when the Logic mode is selected.
+        /// </summary>
+        [Description("The value that specifies the function of the digital inputs applied to DO0 when the Logic mode is selected.")]
+        public DO0LogicFunctionConfig DO0LogicFunction { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO0LogicFunction register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DO0LogicFunctionConfig GetPayload()
+        {
+            return DO0LogicFunction;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the function of the digital inputs applied to DO0 when the Logic mode is selected.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO0LogicFunction register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Synchronizer.DO0LogicFunction.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the function of the digital inputs applied to DO0 when the Logic mode is selected.
+    /// </summary>
+    [DisplayName("TimestampedDO0LogicFunctionPayload")]
+    [Description("Creates a timestamped message payload that specifies the function of the digital inputs applied to DO0 when the Logic mode is selected.")]
+    public partial class CreateTimestampedDO0LogicFunctionPayload : CreateDO0LogicFunctionPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the function of the digital inputs applied to DO0 when the Logic mode is selected.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO0LogicFunction register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Synchronizer.DO0LogicFunction.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the minimum number of high digital inputs of the Threshold function (0 to 9).
+    /// </summary>
+    [DisplayName("DO0LogicThresholdPayload")]
+    [Description("Creates a message payload that sets the minimum number of high digital inputs of the Threshold function (0 to 9).")]
+    public partial class CreateDO0LogicThresholdPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the minimum number of high digital inputs of the Threshold function (0 to 9).
+        /// </summary>
+        [Description("The value that sets the minimum number of high digital inputs of the Threshold function (0 to 9).")]
+        public byte DO0LogicThreshold { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO0LogicThreshold register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return DO0LogicThreshold;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the minimum number of high digital inputs of the Threshold function (0 to 9).
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO0LogicThreshold register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Synchronizer.DO0LogicThreshold.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the minimum number of high digital inputs of the Threshold function (0 to 9).
+    /// </summary>
+    [DisplayName("TimestampedDO0LogicThresholdPayload")]
+    [Description("Creates a timestamped message payload that sets the minimum number of high digital inputs of the Threshold function (0 to 9).")]
+    public partial class CreateTimestampedDO0LogicThresholdPayload : CreateDO0LogicThresholdPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the minimum number of high digital inputs of the Threshold function (0 to 9).
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO0LogicThreshold register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Synchronizer.DO0LogicThreshold.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the digital inputs that reset the DO0 output when the SetReset function is selected.
+    /// </summary>
+    [DisplayName("DO0LogicResetInputsPayload")]
+    [Description("Creates a message payload that specifies the digital inputs that reset the DO0 output when the SetReset function is selected.")]
+    public partial class CreateDO0LogicResetInputsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that specifies the digital inputs that reset the DO0 output when the SetReset function is selected.
+        /// </summary>
+        [Description("The value that specifies the digital inputs that reset the DO0 output when the SetReset function is selected.")]
+        public DigitalInputs DO0LogicResetInputs { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO0LogicResetInputs register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalInputs GetPayload()
+        {
+            return DO0LogicResetInputs;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the digital inputs that reset the DO0 output when the SetReset function is selected.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO0LogicResetInputs register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Synchronizer.DO0LogicResetInputs.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the digital inputs that reset the DO0 output when the SetReset function is selected.
+    /// </summary>
+    [DisplayName("TimestampedDO0LogicResetInputsPayload")]
+    [Description("Creates a timestamped message payload that specifies the digital inputs that reset the DO0 output when the SetReset function is selected.")]
+    public partial class CreateTimestampedDO0LogicResetInputsPayload : CreateDO0LogicResetInputsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the digital inputs that reset the DO0 output when the SetReset function is selected.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO0LogicResetInputs register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Synchronizer.DO0LogicResetInputs.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the digital inputs whose rising edge fires the DO0 trigger. The edge is detected whatever the sampling mode is.
+    /// </summary>
+    [DisplayName("DO0TriggerRisingEdgePayload")]
+    [Description("Creates a message payload that specifies the digital inputs whose rising edge fires the DO0 trigger. The edge is detected whatever the sampling mode is.")]
+    public partial class CreateDO0TriggerRisingEdgePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that specifies the digital inputs whose rising edge fires the DO0 trigger. The edge is detected whatever the sampling mode is.
+        /// </summary>
+        [Description("The value that specifies the digital inputs whose rising edge fires the DO0 trigger. The edge is detected whatever the sampling mode is.")]
+        public DigitalInputs DO0TriggerRisingEdge { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO0TriggerRisingEdge register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalInputs GetPayload()
+        {
+            return DO0TriggerRisingEdge;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the digital inputs whose rising edge fires the DO0 trigger. The edge is detected whatever the sampling mode is.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO0TriggerRisingEdge register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Synchronizer.DO0TriggerRisingEdge.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the digital inputs whose rising edge fires the DO0 trigger. The edge is detected whatever the sampling mode is.
+    /// </summary>
+    [DisplayName("TimestampedDO0TriggerRisingEdgePayload")]
+    [Description("Creates a timestamped message payload that specifies the digital inputs whose rising edge fires the DO0 trigger. The edge is detected whatever the sampling mode is.")]
+    public partial class CreateTimestampedDO0TriggerRisingEdgePayload : CreateDO0TriggerRisingEdgePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the digital inputs whose rising edge fires the DO0 trigger. The edge is detected whatever the sampling mode is.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO0TriggerRisingEdge register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Synchronizer.DO0TriggerRisingEdge.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the digital inputs whose falling edge fires the DO0 trigger. The edge is detected whatever the sampling mode is.
+    /// </summary>
+    [DisplayName("DO0TriggerFallingEdgePayload")]
+    [Description("Creates a message payload that specifies the digital inputs whose falling edge fires the DO0 trigger. The edge is detected whatever the sampling mode is.")]
+    public partial class CreateDO0TriggerFallingEdgePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that specifies the digital inputs whose falling edge fires the DO0 trigger. The edge is detected whatever the sampling mode is.
+        /// </summary>
+        [Description("The value that specifies the digital inputs whose falling edge fires the DO0 trigger. The edge is detected whatever the sampling mode is.")]
+        public DigitalInputs DO0TriggerFallingEdge { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO0TriggerFallingEdge register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalInputs GetPayload()
+        {
+            return DO0TriggerFallingEdge;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the digital inputs whose falling edge fires the DO0 trigger. The edge is detected whatever the sampling mode is.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO0TriggerFallingEdge register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Synchronizer.DO0TriggerFallingEdge.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the digital inputs whose falling edge fires the DO0 trigger. The edge is detected whatever the sampling mode is.
+    /// </summary>
+    [DisplayName("TimestampedDO0TriggerFallingEdgePayload")]
+    [Description("Creates a timestamped message payload that specifies the digital inputs whose falling edge fires the DO0 trigger. The edge is detected whatever the sampling mode is.")]
+    public partial class CreateTimestampedDO0TriggerFallingEdgePayload : CreateDO0TriggerFallingEdgePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the digital inputs whose falling edge fires the DO0 trigger. The edge is detected whatever the sampling mode is.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO0TriggerFallingEdge register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Synchronizer.DO0TriggerFallingEdge.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the digital inputs that must match DO0TriggerPattern when the trigger edge occurs.
+    /// </summary>
+    [DisplayName("DO0TriggerPatternMaskPayload")]
+    [Description("Creates a message payload that specifies the digital inputs that must match DO0TriggerPattern when the trigger edge occurs.")]
+    public partial class CreateDO0TriggerPatternMaskPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that specifies the digital inputs that must match DO0TriggerPattern when the trigger edge occurs.
+        /// </summary>
+        [Description("The value that specifies the digital inputs that must match DO0TriggerPattern when the trigger edge occurs.")]
+        public DigitalInputs DO0TriggerPatternMask { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO0TriggerPatternMask register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalInputs GetPayload()
+        {
+            return DO0TriggerPatternMask;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the digital inputs that must match DO0TriggerPattern when the trigger edge occurs.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO0TriggerPatternMask register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Synchronizer.DO0TriggerPatternMask.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the digital inputs that must match DO0TriggerPattern when the trigger edge occurs.
+    /// </summary>
+    [DisplayName("TimestampedDO0TriggerPatternMaskPayload")]
+    [Description("Creates a timestamped message payload that specifies the digital inputs that must match DO0TriggerPattern when the trigger edge occurs.")]
+    public partial class CreateTimestampedDO0TriggerPatternMaskPayload : CreateDO0TriggerPatternMaskPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the digital inputs that must match DO0TriggerPattern when the trigger edge occurs.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO0TriggerPatternMask register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Synchronizer.DO0TriggerPatternMask.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the state required on the digital inputs of DO0TriggerPatternMask for the trigger to fire.
+    /// </summary>
+    [DisplayName("DO0TriggerPatternPayload")]
+    [Description("Creates a message payload that specifies the state required on the digital inputs of DO0TriggerPatternMask for the trigger to fire.")]
+    public partial class CreateDO0TriggerPatternPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that specifies the state required on the digital inputs of DO0TriggerPatternMask for the trigger to fire.
+        /// </summary>
+        [Description("The value that specifies the state required on the digital inputs of DO0TriggerPatternMask for the trigger to fire.")]
+        public DigitalInputs DO0TriggerPattern { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO0TriggerPattern register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalInputs GetPayload()
+        {
+            return DO0TriggerPattern;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the state required on the digital inputs of DO0TriggerPatternMask for the trigger to fire.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO0TriggerPattern register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Synchronizer.DO0TriggerPattern.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the state required on the digital inputs of DO0TriggerPatternMask for the trigger to fire.
+    /// </summary>
+    [DisplayName("TimestampedDO0TriggerPatternPayload")]
+    [Description("Creates a timestamped message payload that specifies the state required on the digital inputs of DO0TriggerPatternMask for the trigger to fire.")]
+    public partial class CreateTimestampedDO0TriggerPatternPayload : CreateDO0TriggerPatternPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the state required on the digital inputs of DO0TriggerPatternMask for the trigger to fire.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO0TriggerPattern register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Synchronizer.DO0TriggerPattern.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the delay, in microseconds, between the trigger and the start of the DO0 pulse. The width of the pulse is set by DO0PulseWidth. When the delay and the width add up to more than 16382, both have a resolution of 2 microseconds.
+    /// </summary>
+    [DisplayName("DO0TriggerDelayPayload")]
+    [Description("Creates a message payload that sets the delay, in microseconds, between the trigger and the start of the DO0 pulse. The width of the pulse is set by DO0PulseWidth. When the delay and the width add up to more than 16382, both have a resolution of 2 microseconds.")]
+    public partial class CreateDO0TriggerDelayPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the delay, in microseconds, between the trigger and the start of the DO0 pulse. The width of the pulse is set by DO0PulseWidth. When the delay and the width add up to more than 16382, both have a resolution of 2 microseconds.
+        /// </summary>
+        [Description("The value that sets the delay, in microseconds, between the trigger and the start of the DO0 pulse. The width of the pulse is set by DO0PulseWidth. When the delay and the width add up to more than 16382, both have a resolution of 2 microseconds.")]
+        public ushort DO0TriggerDelay { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO0TriggerDelay register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return DO0TriggerDelay;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the delay, in microseconds, between the trigger and the start of the DO0 pulse. The width of the pulse is set by DO0PulseWidth. When the delay and the width add up to more than 16382, both have a resolution of 2 microseconds.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO0TriggerDelay register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Synchronizer.DO0TriggerDelay.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the delay, in microseconds, between the trigger and the start of the DO0 pulse. The width of the pulse is set by DO0PulseWidth. When the delay and the width add up to more than 16382, both have a resolution of 2 microseconds.
+    /// </summary>
+    [DisplayName("TimestampedDO0TriggerDelayPayload")]
+    [Description("Creates a timestamped message payload that sets the delay, in microseconds, between the trigger and the start of the DO0 pulse. The width of the pulse is set by DO0PulseWidth. When the delay and the width add up to more than 16382, both have a resolution of 2 microseconds.")]
+    public partial class CreateTimestampedDO0TriggerDelayPayload : CreateDO0TriggerDelayPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the delay, in microseconds, between the trigger and the start of the DO0 pulse. The width of the pulse is set by DO0PulseWidth. When the delay and the width add up to more than 16382, both have a resolution of 2 microseconds.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO0TriggerDelay register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Synchronizer.DO0TriggerDelay.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies when the DO0 trigger can fire again.
+    /// </summary>
+    [DisplayName("DO0TriggerRearmModePayload")]
+    [Description("Creates a message payload that specifies when the DO0 trigger can fire again.")]
+    public partial class CreateDO0TriggerRearmModePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that specifies when the DO0 trigger can fire again.
+        /// </summary>
+        [Description("The value that specifies when the DO0 trigger can fire again.")]
+        public DO0TriggerRearmConfig DO0TriggerRearmMode { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO0TriggerRearmMode register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DO0TriggerRearmConfig GetPayload()
+        {
+            return DO0TriggerRearmMode;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies when the DO0 trigger can fire again.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO0TriggerRearmMode register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Synchronizer.DO0TriggerRearmMode.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies when the DO0 trigger can fire again.
+    /// </summary>
+    [DisplayName("TimestampedDO0TriggerRearmModePayload")]
+    [Description("Creates a timestamped message payload that specifies when the DO0 trigger can fire again.")]
+    public partial class CreateTimestampedDO0TriggerRearmModePayload : CreateDO0TriggerRearmModePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies when the DO0 trigger can fire again.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO0TriggerRearmMode register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Synchronizer.DO0TriggerRearmMode.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that arms (1) or disarms (0) the DO0 trigger. The trigger is armed when the Trigger mode is selected and is disarmed after firing when the Manual re-arm mode is used.
+    /// </summary>
+    [DisplayName("DO0TriggerArmPayload")]
+    [Description("Creates a message payload that arms (1) or disarms (0) the DO0 trigger. The trigger is armed when the Trigger mode is selected and is disarmed after firing when the Manual re-arm mode is used.")]
+    public partial class CreateDO0TriggerArmPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that arms (1) or disarms (0) the DO0 trigger. The trigger is armed when the Trigger mode is selected and is disarmed after firing when the Manual re-arm mode is used.
+        /// </summary>
+        [Description("The value that arms (1) or disarms (0) the DO0 trigger. The trigger is armed when the Trigger mode is selected and is disarmed after firing when the Manual re-arm mode is used.")]
+        public byte DO0TriggerArm { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO0TriggerArm register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return DO0TriggerArm;
+        }
+
+        /// <summary>
+        /// Creates a message that arms (1) or disarms (0) the DO0 trigger. The trigger is armed when the Trigger mode is selected and is disarmed after firing when the Manual re-arm mode is used.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO0TriggerArm register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Synchronizer.DO0TriggerArm.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that arms (1) or disarms (0) the DO0 trigger. The trigger is armed when the Trigger mode is selected and is disarmed after firing when the Manual re-arm mode is used.
+    /// </summary>
+    [DisplayName("TimestampedDO0TriggerArmPayload")]
+    [Description("Creates a timestamped message payload that arms (1) or disarms (0) the DO0 trigger. The trigger is armed when the Trigger mode is selected and is disarmed after firing when the Manual re-arm mode is used.")]
+    public partial class CreateTimestampedDO0TriggerArmPayload : CreateDO0TriggerArmPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that arms (1) or disarms (0) the DO0 trigger. The trigger is armed when the Trigger mode is selected and is disarmed after firing when the Manual re-arm mode is used.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO0TriggerArm register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Synchronizer.DO0TriggerArm.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the durations, in microseconds, of the segments played on DO0 in the Pattern mode (1 to 16383). The segments alternate between high and low, starting high, and the pattern ends at the first zero. The number of segments must be even.
+    /// </summary>
+    [DisplayName("DO0PatternPayload")]
+    [Description("Creates a message payload that sets the durations, in microseconds, of the segments played on DO0 in the Pattern mode (1 to 16383). The segments alternate between high and low, starting high, and the pattern ends at the first zero. The number of segments must be even.")]
+    public partial class CreateDO0PatternPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the durations, in microseconds, of the segments played on DO0 in the Pattern mode (1 to 16383). The segments alternate between high and low, starting high, and the pattern ends at the first zero. The number of segments must be even.
+        /// </summary>
+        [Description("The value that sets the durations, in microseconds, of the segments played on DO0 in the Pattern mode (1 to 16383). The segments alternate between high and low, starting high, and the pattern ends at the first zero. The number of segments must be even.")]
+        public ushort[] DO0Pattern { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO0Pattern register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort[] GetPayload()
+        {
+            return DO0Pattern;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the durations, in microseconds, of the segments played on DO0 in the Pattern mode (1 to 16383). The segments alternate between high and low, starting high, and the pattern ends at the first zero. The number of segments must be even.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO0Pattern register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Synchronizer.DO0Pattern.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the durations, in microseconds, of the segments played on DO0 in the Pattern mode (1 to 16383). The segments alternate between high and low, starting high, and the pattern ends at the first zero. The number of segments must be even.
+    /// </summary>
+    [DisplayName("TimestampedDO0PatternPayload")]
+    [Description("Creates a timestamped message payload that sets the durations, in microseconds, of the segments played on DO0 in the Pattern mode (1 to 16383). The segments alternate between high and low, starting high, and the pattern ends at the first zero. The number of segments must be even.")]
+    public partial class CreateTimestampedDO0PatternPayload : CreateDO0PatternPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the durations, in microseconds, of the segments played on DO0 in the Pattern mode (1 to 16383). The segments alternate between high and low, starting high, and the pattern ends at the first zero. The number of segments must be even.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO0Pattern register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Synchronizer.DO0Pattern.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the number of times the DO0 pattern is played. If zero, the pattern repeats until stopped.
+    /// </summary>
+    [DisplayName("DO0PatternRepeatPayload")]
+    [Description("Creates a message payload that sets the number of times the DO0 pattern is played. If zero, the pattern repeats until stopped.")]
+    public partial class CreateDO0PatternRepeatPayload
     {
         /// <summary>
-        /// Initializes a new instance of the <see cref="CreateMessage"/> class.
+        /// Gets or sets the value that sets the number of times the DO0 pattern is played. If zero, the pattern repeats until stopped.
         /// </summary>
-        public CreateMessage()
+        [Description("The value that sets the number of times the DO0 pattern is played. If zero, the pattern repeats until stopped.")]
+        public byte DO0PatternRepeat { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO0PatternRepeat register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
         {
-            Payload = new CreateDigitalInputStatePayload();
+            return DO0PatternRepeat;
         }
 
-        string INamedElement.Name => $"{nameof(Synchronizer)}.{GetElementDisplayName(Payload)}";
+        /// <summary>
+        /// Creates a message that sets the number of times the DO0 pattern is played. If zero, the pattern repeats until stopped.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO0PatternRepeat register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Synchronizer.DO0PatternRepeat.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the number of times the DO0 pattern is played. If zero, the pattern repeats until stopped.
+    /// </summary>
+    [DisplayName("TimestampedDO0PatternRepeatPayload")]
+    [Description("Creates a timestamped message payload that sets the number of times the DO0 pattern is played. If zero, the pattern repeats until stopped.")]
+    public partial class CreateTimestampedDO0PatternRepeatPayload : CreateDO0PatternRepeatPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the number of times the DO0 pattern is played. If zero, the pattern repeats until stopped.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO0PatternRepeat register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Synchronizer.DO0PatternRepeat.FromPayload(timestamp, messageType, GetPayload());
+        }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that state of the digital input pins. An event will be emitted when the value of any digital input pin changes.
+    /// that specifies the digital inputs whose rising edge starts the DO0 pattern. The edge is detected whatever the sampling mode is.
     /// </summary>
-    [DisplayName("DigitalInputStatePayload")]
-    [Description("Creates a message payload that state of the digital input pins. An event will be emitted when the value of any digital input pin changes.")]
-    public partial class CreateDigitalInputStatePayload
+    [DisplayName("DO0PatternTriggerPayload")]
+    [Description("Creates a message payload that specifies the digital inputs whose rising edge starts the DO0 pattern. The edge is detected whatever the sampling mode is.")]
+    public partial class CreateDO0PatternTriggerPayload
     {
         /// <summary>
-        /// Gets or sets the value that state of the digital input pins. An event will be emitted when the value of any digital input pin changes.
+        /// Gets or sets the value that specifies the digital inputs whose rising edge starts the DO0 pattern. The edge is detected whatever the sampling mode is.
         /// </summary>
-        [Description("The value that state of the digital input pins. An event will be emitted when the value of any digital input pin changes.")]
-        public DigitalInputs DigitalInputState { get; set; }
+        [Description("The value that specifies the digital inputs whose rising edge starts the DO0 pattern. The edge is detected whatever the sampling mode is.")]
+        public DigitalInputs DO0PatternTrigger { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DigitalInputState register.
+        /// Creates a message payload for the DO0PatternTrigger register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
         public DigitalInputs GetPayload()
         {
-            return DigitalInputState;
+            return DO0PatternTrigger;
         }
 
         /// <summary>
-        /// Creates a message that state of the digital input pins. An event will be emitted when the value of any digital input pin changes.
+        /// Creates a message that specifies the digital inputs whose rising edge starts the DO0 pattern. The edge is detected whatever the sampling mode is.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DigitalInputState register.</returns>
+        /// <returns>A new message for the DO0PatternTrigger register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Synchronizer.DigitalInputState.FromPayload(messageType, GetPayload());
+            return Harp.Synchronizer.DO0PatternTrigger.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that state of the digital input pins. An event will be emitted when the value of any digital input pin changes.
+    /// that specifies the digital inputs whose rising edge starts the DO0 pattern. The edge is detected whatever the sampling mode is.
     /// </summary>
-    [DisplayName("TimestampedDigitalInputStatePayload")]
-    [Description("Creates a timestamped message payload that state of the digital input pins. An event will be emitted when the value of any digital input pin changes.")]
-    public partial class CreateTimestampedDigitalInputStatePayload : CreateDigitalInputStatePayload
+    [DisplayName("TimestampedDO0PatternTriggerPayload")]
+    [Description("Creates a timestamped message payload that specifies the digital inputs whose rising edge starts the DO0 pattern. The edge is detected whatever the sampling mode is.")]
+    public partial class CreateTimestampedDO0PatternTriggerPayload : CreateDO0PatternTriggerPayload
     {
         /// <summary>
-        /// Creates a timestamped message that state of the digital input pins. An event will be emitted when the value of any digital input pin changes.
+        /// Creates a timestamped message that specifies the digital inputs whose rising edge starts the DO0 pattern. The edge is detected whatever the sampling mode is.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DigitalInputState register.</returns>
+        /// <returns>A new timestamped message for the DO0PatternTrigger register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Synchronizer.DigitalInputState.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Synchronizer.DO0PatternTrigger.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that status of the digital output pin 0.
+    /// that starts (1) or stops (0) the DO0 pattern. Reads 1 while the pattern is playing.
     /// </summary>
-    [DisplayName("DigitalOutputStatePayload")]
-    [Description("Creates a message payload that status of the digital output pin 0.")]
-    public partial class CreateDigitalOutputStatePayload
+    [DisplayName("DO0PatternControlPayload")]
+    [Description("Creates a message payload that starts (1) or stops (0) the DO0 pattern. Reads 1 while the pattern is playing.")]
+    public partial class CreateDO0PatternControlPayload
     {
         /// <summary>
-        /// Gets or sets the value that status of the digital output pin 0.
+        /// Gets or sets the value that starts (1) or stops (0) the DO0 pattern. Reads 1 while the pattern is playing.
         /// </summary>
-        [Description("The value that status of the digital output pin 0.")]
-        public DigitalOutputs DigitalOutputState { get; set; }
+        [Description("The value that starts (1) or stops (0) the DO0 pattern. Reads 1 while the pattern is playing.")]
+        public byte DO0PatternControl { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DigitalOutputState register.
+        /// Creates a message payload for the DO0PatternControl register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DigitalOutputs GetPayload()
+        public byte GetPayload()
         {
-            return DigitalOutputState;
+            return DO0PatternControl;
         }
 
         /// <summary>
-        /// Creates a message that status of the digital output pin 0.
+        /// Creates a message that starts (1) or stops (0) the DO0 pattern. Reads 1 while the pattern is playing.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DigitalOutputState register.</returns>
+        /// <returns>A new message for the DO0PatternControl register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Synchronizer.DigitalOutputState.FromPayload(messageType, GetPayload());
+            return Harp.Synchronizer.DO0PatternControl.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that status of the digital output pin 0.
+    /// that starts (1) or stops (0) the DO0 pattern. Reads 1 while the pattern is playing.
     /// </summary>
-    [DisplayName("TimestampedDigitalOutputStatePayload")]
-    [Description("Creates a timestamped message payload that status of the digital output pin 0.")]
-    public partial class CreateTimestampedDigitalOutputStatePayload : CreateDigitalOutputStatePayload
+    [DisplayName("TimestampedDO0PatternControlPayload")]
+    [Description("Creates a timestamped message payload that starts (1) or stops (0) the DO0 pattern. Reads 1 while the pattern is playing.")]
+    public partial class CreateTimestampedDO0PatternControlPayload : CreateDO0PatternControlPayload
     {
         /// <summary>
-        /// Creates a timestamped message that status of the digital output pin 0.
+        /// Creates a timestamped message that starts (1) or stops (0) the DO0 pattern. Reads 1 while the pattern is playing.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DigitalOutputState register.</returns>
+        /// <returns>A new timestamped message for the DO0PatternControl register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Synchronizer.DigitalOutputState.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Synchronizer.DO0PatternControl.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that sets the sampling mode for digital input pins.
+    /// that sets the priority of the interrupts that latch the digital inputs. With the High priority the inputs are latched ahead of the communication with the host.
     /// </summary>
-    [DisplayName("DigitalInputsSamplingModePayload")]
-    [Description("Creates a message payload that sets the sampling mode for digital input pins.")]
-    public partial class CreateDigitalInputsSamplingModePayload
+    [DisplayName("DigitalInputsInterruptLevelPayload")]
+    [Description("Creates a message payload that sets the priority of the interrupts that latch the digital inputs. With the High priority the inputs are latched ahead of the communication with the host.")]
+    public partial class CreateDigitalInputsInterruptLevelPayload
     {
         /// <summary>
-        /// Gets or sets the value that sets the sampling mode for digital input pins.
+        /// Gets or sets the value that sets the priority of the interrupts that latch the digital inputs. With the High priority the inputs are latched ahead of the communication with the host.
         /// </summary>
-        [Description("The value that sets the sampling mode for digital input pins.")]
-        public DigitalInputsSamplingConfig DigitalInputsSamplingMode { get; set; }
+        [Description("The value that sets the priority of the interrupts that latch the digital inputs. With the High priority the inputs are latched ahead of the communication with the host.")]
+        public InterruptPriority DigitalInputsInterruptLevel { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DigitalInputsSamplingMode register.
+        /// Creates a message payload for the DigitalInputsInterruptLevel register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DigitalInputsSamplingConfig GetPayload()
+        public InterruptPriority GetPayload()
         {
-            return DigitalInputsSamplingMode;
+            return DigitalInputsInterruptLevel;
         }
 
         /// <summary>
-        /// Creates a message that sets the sampling mode for digital input pins.
+        /// Creates a message that sets the priority of the interrupts that latch the digital inputs. With the High priority the inputs are latched ahead of the communication with the host.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DigitalInputsSamplingMode register.</returns>
+        /// <returns>A new message for the DigitalInputsInterruptLevel register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Synchronizer.DigitalInputsSamplingMode.FromPayload(messageType, GetPayload());
+            return Harp.Synchronizer.DigitalInputsInterruptLevel.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that sets the sampling mode for digital input pins.
+    /// that sets the priority of the interrupts that latch the digital inputs. With the High priority the inputs are latched ahead of the communication with the host.
     /// </summary>
-    [DisplayName("TimestampedDigitalInputsSamplingModePayload")]
-    [Description("Creates a timestamped message payload that sets the sampling mode for digital input pins.")]
-    public partial class CreateTimestampedDigitalInputsSamplingModePayload : CreateDigitalInputsSamplingModePayload
+    [DisplayName("TimestampedDigitalInputsInterruptLevelPayload")]
+    [Description("Creates a timestamped message payload that sets the priority of the interrupts that latch the digital inputs. With the High priority the inputs are latched ahead of the communication with the host.")]
+    public partial class CreateTimestampedDigitalInputsInterruptLevelPayload : CreateDigitalInputsInterruptLevelPayload
     {
         /// <summary>
-        /// Creates a timestamped message that sets the sampling mode for digital input pins.
+        /// Creates a timestamped message that sets the priority of the interrupts that latch the digital inputs. With the High priority the inputs are latched ahead of the communication with the host.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DigitalInputsSamplingMode register.</returns>
+        /// <returns>A new timestamped message for the DigitalInputsInterruptLevel register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Synchronizer.DigitalInputsSamplingMode.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Synchronizer.DigitalInputsInterruptLevel.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that configures how the DO0 pin behaves.
+    /// that worst-case latency, in microseconds, observed between an edge and its latch in the InputsChangeHardwareCapture mode. Writing any value clears the measurement.
     /// </summary>
-    [DisplayName("DO0ConfigPayload")]
-    [Description("Creates a message payload that configures how the DO0 pin behaves.")]
-    public partial class CreateDO0ConfigPayload
+    [DisplayName("CaptureLatencyMaxPayload")]
+    [Description("Creates a message payload that worst-case latency, in microseconds, observed between an edge and its latch in the InputsChangeHardwareCapture mode. Writing any value clears the measurement.")]
+    public partial class CreateCaptureLatencyMaxPayload
     {
         /// <summary>
-        /// Gets or sets the value that configures how the DO0 pin behaves.
+        /// Gets or sets the value that worst-case latency, in microseconds, observed between an edge and its latch in the InputsChangeHardwareCapture mode. Writing any value clears the measurement.
         /// </summary>
-        [Description("The value that configures how the DO0 pin behaves.")]
-        public DO0ConfigMode DO0Config { get; set; }
+        [Description("The value that worst-case latency, in microseconds, observed between an edge and its latch in the InputsChangeHardwareCapture mode. Writing any value clears the measurement.")]
+        public ushort CaptureLatencyMax { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO0Config register.
+        /// Creates a message payload for the CaptureLatencyMax register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DO0ConfigMode GetPayload()
+        public ushort GetPayload()
         {
-            return DO0Config;
+            return CaptureLatencyMax;
         }
 
         /// <summary>
-        /// Creates a message that configures how the DO0 pin behaves.
+        /// Creates a message that worst-case latency, in microseconds, observed between an edge and its latch in the InputsChangeHardwareCapture mode. Writing any value clears the measurement.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO0Config register.</returns>
+        /// <returns>A new message for the CaptureLatencyMax register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Synchronizer.DO0Config.FromPayload(messageType, GetPayload());
+            return Harp.Synchronizer.CaptureLatencyMax.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that configures how the DO0 pin behaves.
+    /// that worst-case latency, in microseconds, observed between an edge and its latch in the InputsChangeHardwareCapture mode. Writing any value clears the measurement.
     /// </summary>
-    [DisplayName("TimestampedDO0ConfigPayload")]
-    [Description("Creates a timestamped message payload that configures how the DO0 pin behaves.")]
-    public partial class CreateTimestampedDO0ConfigPayload : CreateDO0ConfigPayload
+    [DisplayName("TimestampedCaptureLatencyMaxPayload")]
+    [Description("Creates a timestamped message payload that worst-case latency, in microseconds, observed between an edge and its latch in the InputsChangeHardwareCapture mode. Writing any value clears the measurement.")]
+    public partial class CreateTimestampedCaptureLatencyMaxPayload : CreateCaptureLatencyMaxPayload
     {
         /// <summary>
-        /// Creates a timestamped message that configures how the DO0 pin behaves.
+        /// Creates a timestamped message that worst-case latency, in microseconds, observed between an edge and its latch in the InputsChangeHardwareCapture mode. Writing any value clears the measurement.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO0Config register.</returns>
+        /// <returns>A new timestamped message for the CaptureLatencyMax register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Synchronizer.DO0Config.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Synchronizer.CaptureLatencyMax.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that specifies all the active events in the device.
+    /// that counters of the device's performance since the last write to this register. Writing any value clears the counters.
     /// </summary>
-    [DisplayName("EnableEventsPayload")]
-    [Description("Creates a message payload that specifies all the active events in the device.")]
-    public partial class CreateEnableEventsPayload
+    [DisplayName("TelemetryPayload")]
+    [Description("Creates a message payload that counters of the device's performance since the last write to this register. Writing any value clears the counters.")]
+    public partial class CreateTelemetryPayload
     {
         /// <summary>
-        /// Gets or sets the value that specifies all the active events in the device.
+        /// Gets or sets a value that the number of events sent by the device.
         /// </summary>
-        [Description("The value that specifies all the active events in the device.")]
-        public SynchronizerEvents EnableEvents { get; set; }
+        [Description("The number of events sent by the device.")]
+        public uint EventsSent { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the EnableEvents register.
+        /// Gets or sets a value that the number of digital input readings dropped because the device's event queue was full.
+        /// </summary>
+        [Description("The number of digital input readings dropped because the device's event queue was full.")]
+        public uint ReadingsDropped { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the number of digital input readings that did not generate an event.
+        /// </summary>
+        [Description("The number of digital input readings that did not generate an event.")]
+        public uint ReadingsFiltered { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the maximum latency, in microseconds, between the latch of the digital inputs and the sending of their event.
+        /// </summary>
+        [Description("The maximum latency, in microseconds, between the latch of the digital inputs and the sending of their event.")]
+        public uint LatencyMax { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the average latency, in microseconds, between the latch of the digital inputs and the sending of their event.
+        /// </summary>
+        [Description("The average latency, in microseconds, between the latch of the digital inputs and the sending of their event.")]
+        public uint LatencyAverage { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the maximum number of CPU cycles taken to latch the digital inputs in their interrupts, with a resolution of 64 cycles.
+        /// </summary>
+        [Description("The maximum number of CPU cycles taken to latch the digital inputs in their interrupts, with a resolution of 64 cycles.")]
+        public uint LatchCyclesMax { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value that the average number of CPU cycles taken to latch the digital inputs in their interrupts, with a resolution of 64 cycles.
+        /// </summary>
+        [Description("The average number of CPU cycles taken to latch the digital inputs in their interrupts, with a resolution of 64 cycles.")]
+        public uint LatchCyclesAverage { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Telemetry register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public SynchronizerEvents GetPayload()
+        public TelemetryPayload GetPayload()
         {
-            return EnableEvents;
+            TelemetryPayload value;
+            value.EventsSent = EventsSent;
+            value.ReadingsDropped = ReadingsDropped;
+            value.ReadingsFiltered = ReadingsFiltered;
+            value.LatencyMax = LatencyMax;
+            value.LatencyAverage = LatencyAverage;
+            value.LatchCyclesMax = LatchCyclesMax;
+            value.LatchCyclesAverage = LatchCyclesAverage;
+            return value;
         }
 
         /// <summary>
-        /// Creates a message that specifies all the active events in the device.
+        /// Creates a message that counters of the device's performance since the last write to this register. Writing any value clears the counters.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the EnableEvents register.</returns>
+        /// <returns>A new message for the Telemetry register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Synchronizer.EnableEvents.FromPayload(messageType, GetPayload());
+            return Harp.Synchronizer.Telemetry.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that specifies all the active events in the device.
+    /// that counters of the device's performance since the last write to this register. Writing any value clears the counters.
     /// </summary>
-    [DisplayName("TimestampedEnableEventsPayload")]
-    [Description("Creates a timestamped message payload that specifies all the active events in the device.")]
-    public partial class CreateTimestampedEnableEventsPayload : CreateEnableEventsPayload
+    [DisplayName("TimestampedTelemetryPayload")]
+    [Description("Creates a timestamped message payload that counters of the device's performance since the last write to this register. Writing any value clears the counters.")]
+    public partial class CreateTimestampedTelemetryPayload : CreateTelemetryPayload
     {
         /// <summary>
-        /// Creates a timestamped message that specifies all the active events in the device.
+        /// Creates a timestamped message that counters of the device's performance since the last write to this register. Writing any value clears the counters.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the EnableEvents register.</returns>
+        /// <returns>A new timestamped message for the Telemetry register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Synchronizer.EnableEvents.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Synchronizer.Telemetry.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the time, in milliseconds, between the events of the Telemetry register.
+    /// </summary>
+    [DisplayName("TelemetryEventPeriodPayload")]
+    [Description("Creates a message payload that sets the time, in milliseconds, between the events of the Telemetry register.")]
+    public partial class CreateTelemetryEventPeriodPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the time, in milliseconds, between the events of the Telemetry register.
+        /// </summary>
+        [Description("The value that sets the time, in milliseconds, between the events of the Telemetry register.")]
+        public ushort TelemetryEventPeriod { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the TelemetryEventPeriod register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return TelemetryEventPeriod;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the time, in milliseconds, between the events of the Telemetry register.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the TelemetryEventPeriod register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Synchronizer.TelemetryEventPeriod.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the time, in milliseconds, between the events of the Telemetry register.
+    /// </summary>
+    [DisplayName("TimestampedTelemetryEventPeriodPayload")]
+    [Description("Creates a timestamped message payload that sets the time, in milliseconds, between the events of the Telemetry register.")]
+    public partial class CreateTimestampedTelemetryEventPeriodPayload : CreateTelemetryEventPeriodPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the time, in milliseconds, between the events of the Telemetry register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the TelemetryEventPeriod register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Synchronizer.TelemetryEventPeriod.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents the payload of the Telemetry register.
+    /// </summary>
+    public struct TelemetryPayload
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="TelemetryPayload"/> structure.
+        /// </summary>
+        /// <param name="eventsSent">The number of events sent by the device.</param>
+        /// <param name="readingsDropped">The number of digital input readings dropped because the device's event queue was full.</param>
+        /// <param name="readingsFiltered">The number of digital input readings that did not generate an event.</param>
+        /// <param name="latencyMax">The maximum latency, in microseconds, between the latch of the digital inputs and the sending of their event.</param>
+        /// <param name="latencyAverage">The average latency, in microseconds, between the latch of the digital inputs and the sending of their event.</param>
+        /// <param name="latchCyclesMax">The maximum number of CPU cycles taken to latch the digital inputs in their interrupts, with a resolution of 64 cycles.</param>
+        /// <param name="latchCyclesAverage">The average number of CPU cycles taken to latch the digital inputs in their interrupts, with a resolution of 64 cycles.</param>
+        public TelemetryPayload(
+            uint eventsSent,
+            uint readingsDropped,
+            uint readingsFiltered,
+            uint latencyMax,
+            uint latencyAverage,
+            uint latchCyclesMax,
+            uint latchCyclesAverage)
+        {
+            EventsSent = eventsSent;
+            ReadingsDropped = readingsDropped;
+            ReadingsFiltered = readingsFiltered;
+            LatencyMax = latencyMax;
+            LatencyAverage = latencyAverage;
+            LatchCyclesMax = latchCyclesMax;
+            LatchCyclesAverage = latchCyclesAverage;
         }
+
+        /// <summary>
+        /// The number of events sent by the device.
+        /// </summary>
+        public uint EventsSent;
+
+        /// <summary>
+        /// The number of digital input readings dropped because the device's event queue was full.
+        /// </summary>
+        public uint ReadingsDropped;
+
+        /// <summary>
+        /// The number of digital input readings that did not generate an event.
+        /// </summary>
+        public uint ReadingsFiltered;
+
+        /// <summary>
+        /// The maximum latency, in microseconds, between the latch of the digital inputs and the sending of their event.
+        /// </summary>
+        public uint LatencyMax;
+
+        /// <summary>
+        /// The average latency, in microseconds, between the latch of the digital inputs and the sending of their event.
+        /// </summary>
+        public uint LatencyAverage;
+
+        /// <summary>
+        /// The maximum number of CPU cycles taken to latch the digital inputs in their interrupts, with a resolution of 64 cycles.
+        /// </summary>
+        public uint LatchCyclesMax;
+
+        /// <summary>
+        /// The average number of CPU cycles taken to latch the digital inputs in their interrupts, with a resolution of 64 cycles.
+        /// </summary>
+        public uint LatchCyclesAverage;
     }
 
     /// <summary>
     /// Specifies the state of digital input port lines.
     /// </summary>
     [Flags]
-    public enum DigitalInputs : byte
+    public enum DigitalInputs : ushort
     {
         None = 0x0,
         DI0 = 0x1,
         DI1 = 0x2,
-        DI2 = 0x3,
-        DI3 = 0x4,
-        DI4 = 0x8,
-        DI5 = 0x10,
-        DI6 = 0x20,
-        DI7 = 0x40,
-        DI8 = 0x80
+        DI2 = 0x4,
+        DI3 = 0x8,
+        DI4 = 0x10,
+        DI5 = 0x20,
+        DI6 = 0x40,
+        DI7 = 0x80,
+        DI8 = 0x100
     }
 
     /// <summary>
@@ -1108,7 +6414,9 @@ namespace Harp.Synchronizer
     public enum SynchronizerEvents : byte
     {
         None = 0x0,
-        DigitalInputState = 0x1
+        DigitalInputState = 0x1,
+        DigitalInputsEdgeCount = 0x2,
+        Telemetry = 0x4
     }
 
     /// <summary>
@@ -1124,7 +6432,53 @@ namespace Harp.Synchronizer
         Sampling250Hz = 5,
         Sampling500Hz = 6,
         Sampling1000Hz = 7,
-        Sampling2000Hz = 8
+        Sampling2000Hz = 8,
+        InputsChangeHardwareCapture = 9,
+        Sampling1000HzBatched = 10,
+        Sampling2000HzBatched = 11,
+        SamplingTimer = 12,
+        SamplingTimerBatched = 13
+    }
+
+    /// <summary>
+    /// Available modes for emitting the events of the fixed-rate sampling modes.
+    /// </summary>
+    public enum SamplingEventConfig : byte
+    {
+        EverySample = 0,
+        OnChange = 1
+    }
+
+    /// <summary>
+    /// Available functions of the DO0 logic.
+    /// </summary>
+    public enum DO0LogicFunctionConfig : byte
+    {
+        And = 0,
+        Or = 1,
+        Xor = 2,
+        Threshold = 3,
+        SetReset = 4
+    }
+
+    /// <summary>
+    /// Available priority levels of the inputs' interrupts.
+    /// </summary>
+    public enum InterruptPriority : byte
+    {
+        Low = 1,
+        Medium = 2,
+        High = 3
+    }
+
+    /// <summary>
+    /// Available re-arm policies of the DO0 trigger.
+    /// </summary>
+    public enum DO0TriggerRearmConfig : byte
+    {
+        Retrigger = 0,
+        AfterPulse = 1,
+        Manual = 2
     }
 
     /// <summary>
@@ -1140,6 +6494,10 @@ namespace Harp.Synchronizer
         Pulse1msOnInputsChange = 5,
         Pulse500usOnInputsChange = 6,
         Pulse250usOnInputsChange = 7,
-        AnyInputs = 8
+        AnyInputs = 8,
+        HardwarePulseOnDI0Edge = 9,
+        Logic = 10,
+        Trigger = 11,
+        Pattern = 12
     }
 }
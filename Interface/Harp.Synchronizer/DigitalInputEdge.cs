@@ -0,0 +1,225 @@
+using Bonsai;
+using Bonsai.Harp;
+using System;
+using System.ComponentModel;
+using System.Reactive;
+using System.Reactive.Linq;
+
+namespace Harp.Synchronizer
+{
+    /// <summary>
+    /// Represents a transition of a single digital input line.
+    /// </summary>
+    public struct DigitalInputEdge
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="DigitalInputEdge"/> structure
+        /// for the specified input line and transition direction.
+        /// </summary>
+        /// <param name="input">The digital input line where the transition occurred.</param>
+        /// <param name="rising">
+        /// <see langword="true"/> if the line went from low to high; otherwise, <see langword="false"/>.
+        /// </param>
+        public DigitalInputEdge(DigitalInputs input, bool rising)
+        {
+            Input = input;
+            Rising = rising;
+        }
+
+        /// <summary>
+        /// Gets the digital input line where the transition occurred.
+        /// </summary>
+        public DigitalInputs Input { get; }
+
+        /// <summary>
+        /// Gets a value indicating whether the line went from low to high.
+        /// </summary>
+        public bool Rising { get; }
+
+        /// <inheritdoc/>
+        public override string ToString()
+        {
+            return $"{Input} {(Rising ? "Rising" : "Falling")}";
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that converts the digital input readings reported by the
+    /// <see cref="Synchronizer"/> device into the timestamped edges of each input line.
+    /// </summary>
+    [Description("Converts the digital input readings into the timestamped edges of each input line.")]
+    public class DetectDigitalInputEdges : Combinator<Timestamped<DigitalInputs>, Timestamped<DigitalInputEdge>>
+    {
+        /// <summary>
+        /// Gets or sets the digital input lines for which edges are reported.
+        /// </summary>
+        [Description("The digital input lines for which edges are reported.")]
+        public DigitalInputs Inputs { get; set; } = DigitalInputEdgeColumns.AllInputs;
+
+        /// <summary>
+        /// Compares each digital input reading with the previous one and reports every
+        /// input line that changed between them. The first reading only sets the initial state.
+        /// </summary>
+        /// <param name="source">A sequence of timestamped digital input readings.</param>
+        /// <returns>
+        /// A sequence of timestamped edges, ordered by input line within each reading.
+        /// </returns>
+        public override IObservable<Timestamped<DigitalInputEdge>> Process(IObservable<Timestamped<DigitalInputs>> source)
+        {
+            return Observable.Create<Timestamped<DigitalInputEdge>>(observer =>
+            {
+                var mask = (int)(Inputs & DigitalInputEdgeColumns.AllInputs);
+                var previous = -1;
+                var stateObserver = Observer.Create<Timestamped<DigitalInputs>>(
+                    value =>
+                    {
+                        var state = (int)value.Value & mask;
+                        var changed = previous < 0 ? 0 : state ^ previous;
+                        previous = state;
+                        while (changed != 0)
+                        {
+                            var bit = changed & -changed;
+                            changed &= changed - 1;
+                            var edge = new DigitalInputEdge((DigitalInputs)bit, (state & bit) != 0);
+                            observer.OnNext(Timestamped.Create(edge, value.Seconds));
+                        }
+                    },
+                    observer.OnError,
+                    observer.OnCompleted);
+                return source.Subscribe(stateObserver);
+            });
+        }
+    }
+
+    /// <summary>
+    /// Represents the edges of the digital input lines extracted from a recording,
+    /// stored as parallel arrays of timestamps, input lines and transition directions.
+    /// </summary>
+    public class DigitalInputEdgeColumns
+    {
+        internal const DigitalInputs AllInputs =
+            DigitalInputs.DI0 | DigitalInputs.DI1 | DigitalInputs.DI2 |
+            DigitalInputs.DI3 | DigitalInputs.DI4 | DigitalInputs.DI5 |
+            DigitalInputs.DI6 | DigitalInputs.DI7 | DigitalInputs.DI8;
+
+        DigitalInputEdgeColumns(double[] seconds, DigitalInputs[] inputs, bool[] rising)
+        {
+            Seconds = seconds;
+            Inputs = inputs;
+            Rising = rising;
+        }
+
+        /// <summary>
+        /// Gets the number of edges.
+        /// </summary>
+        public int Count => Seconds.Length;
+
+        /// <summary>
+        /// Gets the timestamp of each edge, in seconds.
+        /// </summary>
+        public double[] Seconds { get; }
+
+        /// <summary>
+        /// Gets the digital input line of each edge.
+        /// </summary>
+        public DigitalInputs[] Inputs { get; }
+
+        /// <summary>
+        /// Gets a value for each edge indicating whether the line went from low to high.
+        /// </summary>
+        public bool[] Rising { get; }
+
+        /// <summary>
+        /// Extracts the edges of every digital input line from a sequence of recorded readings.
+        /// </summary>
+        /// <param name="states">The recorded digital input readings.</param>
+        /// <returns>
+        /// A <see cref="DigitalInputEdgeColumns"/> object holding the edges in time order,
+        /// ordered by input line within each reading.
+        /// </returns>
+        public static DigitalInputEdgeColumns FromStates(DigitalInputStateColumns states)
+        {
+            return FromStates(states, AllInputs);
+        }
+
+        /// <summary>
+        /// Extracts the edges of the specified digital input lines from a sequence of recorded readings.
+        /// </summary>
+        /// <param name="states">The recorded digital input readings.</param>
+        /// <param name="inputs">The digital input lines for which edges are extracted.</param>
+        /// <returns>
+        /// A <see cref="DigitalInputEdgeColumns"/> object holding the edges in time order,
+        /// ordered by input line within each reading.
+        /// </returns>
+        public static DigitalInputEdgeColumns FromStates(DigitalInputStateColumns states, DigitalInputs inputs)
+        {
+            if (states == null) throw new ArgumentNullException(nameof(states));
+            var mask = (int)(inputs & AllInputs);
+            var values = states.States;
+
+            var count = 0;
+            for (int i = 1; i < values.Length; i++)
+            {
+                count += PopCount(((int)values[i] ^ (int)values[i - 1]) & mask);
+            }
+
+            var seconds = new double[count];
+            var edgeInputs = new DigitalInputs[count];
+            var rising = new bool[count];
+            var index = 0;
+            for (int i = 1; i < values.Length; i++)
+            {
+                var state = (int)values[i];
+                var changed = (state ^ (int)values[i - 1]) & mask;
+                while (changed != 0)
+                {
+                    var bit = changed & -changed;
+                    changed &= changed - 1;
+                    seconds[index] = states.Seconds[i];
+                    edgeInputs[index] = (DigitalInputs)bit;
+                    rising[index] = (state & bit) != 0;
+                    index++;
+                }
+            }
+
+            return new DigitalInputEdgeColumns(seconds, edgeInputs, rising);
+        }
+
+        /// <summary>
+        /// Gets the timestamps of all rising or falling edges of a single digital input line.
+        /// </summary>
+        /// <param name="input">The digital input line.</param>
+        /// <param name="rising">
+        /// <see langword="true"/> to get the rising edges; <see langword="false"/> to get the falling edges.
+        /// </param>
+        /// <returns>An array with the timestamp of each matching edge, in seconds.</returns>
+        public double[] GetEdgeTimes(DigitalInputs input, bool rising)
+        {
+            var count = 0;
+            for (int i = 0; i < Inputs.Length; i++)
+            {
+                if (Inputs[i] == input && Rising[i] == rising) count++;
+            }
+
+            var result = new double[count];
+            var index = 0;
+            for (int i = 0; i < Inputs.Length; i++)
+            {
+                if (Inputs[i] == input && Rising[i] == rising)
+                {
+                    result[index++] = Seconds[i];
+                }
+            }
+
+            return result;
+        }
+
+        static int PopCount(int value)
+        {
+            value -= (value >> 1) & 0x5555;
+            value = (value & 0x3333) + ((value >> 2) & 0x3333);
+            value = (value + (value >> 4)) & 0x0F0F;
+            return (value + (value >> 8)) & 0x1F;
+        }
+    }
+}
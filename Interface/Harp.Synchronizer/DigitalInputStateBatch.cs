@@ -0,0 +1,83 @@
+using Bonsai;
+using Bonsai.Harp;
+using System;
+using System.ComponentModel;
+using System.Reactive.Linq;
+
+namespace Harp.Synchronizer
+{
+    public partial class DigitalInputStateBatch
+    {
+        /// <summary>
+        /// Represents the number of digital input readings in each batch. This field is constant.
+        /// </summary>
+        public const int SampleCount = RegisterLength - 1;
+
+        /// <summary>
+        /// Expands a <see cref="DigitalInputStateBatch"/> register message into the
+        /// individual timestamped digital input readings.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>
+        /// An array with the digital input readings in the batch, each timestamped according
+        /// to the sample period of the batch.
+        /// </returns>
+        public static Timestamped<DigitalInputs>[] GetTimestampedSamples(HarpMessage message)
+        {
+            var samples = new Timestamped<DigitalInputs>[message.GetPayload().Count / sizeof(ushort) - 1];
+            CopyTimestampedSamples(message, samples, 0);
+            return samples;
+        }
+
+        /// <summary>
+        /// Copies the individual timestamped digital input readings in a <see cref="DigitalInputStateBatch"/>
+        /// register message into an existing array, reading the message payload in place.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <param name="array">The array that receives the digital input readings.</param>
+        /// <param name="index">The index in <paramref name="array"/> at which the copy begins.</param>
+        /// <returns>The number of digital input readings copied into the array.</returns>
+        public static int CopyTimestampedSamples(HarpMessage message, Timestamped<DigitalInputs>[] array, int index)
+        {
+            if (message.PayloadType != (PayloadType.Timestamp | RegisterType))
+            {
+                throw new InvalidOperationException("The message payload type does not match the DigitalInputStateBatch register.");
+            }
+
+            var payload = message.GetPayload();
+            var seconds = message.GetTimestamp();
+            var period = BitConverter.ToUInt16(payload.Array, payload.Offset) * 1e-6;
+            var count = payload.Count / sizeof(ushort) - 1;
+            for (int i = 0; i < count; i++)
+            {
+                var state = BitConverter.ToUInt16(payload.Array, payload.Offset + (i + 1) * sizeof(ushort));
+                array[index + i] = Timestamped.Create((DigitalInputs)state, seconds + i * period);
+            }
+
+            return count;
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that expands the batched digital input readings reported
+    /// by the <see cref="Synchronizer"/> device into individual timestamped readings.
+    /// </summary>
+    [Description("Expands the batched digital input readings into individual timestamped readings.")]
+    public class ExpandDigitalInputStateBatch : Combinator<HarpMessage, Timestamped<DigitalInputs>>
+    {
+        /// <summary>
+        /// Expands an observable sequence of <see cref="DigitalInputStateBatch"/> messages
+        /// into the individual timestamped digital input readings.
+        /// </summary>
+        /// <param name="source">The sequence of Harp device messages.</param>
+        /// <returns>
+        /// A sequence of timestamped digital input readings, in the order they were sampled.
+        /// </returns>
+        public override IObservable<Timestamped<DigitalInputs>> Process(IObservable<HarpMessage> source)
+        {
+            return source
+                .Where(message => message.Address == DigitalInputStateBatch.Address && !message.Error)
+                .SelectMany(DigitalInputStateBatch.GetTimestampedSamples);
+        }
+    }
+}
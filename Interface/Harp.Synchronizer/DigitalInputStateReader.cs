@@ -0,0 +1,134 @@
+using System;
+using System.IO;
+
+namespace Harp.Synchronizer
+{
+    /// <summary>
+    /// Provides methods for decoding the digital input readings in recorded
+    /// binary files of raw <see cref="Synchronizer"/> device messages.
+    /// </summary>
+    public static class DigitalInputStateReader
+    {
+        /// <summary>
+        /// Decodes all <see cref="DigitalInputState"/> and <see cref="DigitalInputStateBatch"/>
+        /// messages in a binary file into columnar arrays of timestamps and input states.
+        /// </summary>
+        /// <param name="fileName">The path to the binary file containing the raw device messages.</param>
+        /// <returns>
+        /// A <see cref="DigitalInputStateColumns"/> object holding every digital input reading
+        /// in the file, in the order they were recorded.
+        /// </returns>
+        public static DigitalInputStateColumns ReadFile(string fileName)
+        {
+            using (var stream = new FileStream(fileName, FileMode.Open, FileAccess.Read, FileShare.Read, 4096, FileOptions.SequentialScan))
+            {
+                return Read(stream);
+            }
+        }
+
+        /// <summary>
+        /// Decodes all <see cref="DigitalInputState"/> and <see cref="DigitalInputStateBatch"/>
+        /// messages in a stream into columnar arrays of timestamps and input states.
+        /// </summary>
+        /// <param name="stream">The stream containing the raw device messages.</param>
+        /// <returns>
+        /// A <see cref="DigitalInputStateColumns"/> object holding every digital input reading
+        /// in the stream, in the order they were recorded.
+        /// </returns>
+        /// <remarks>
+        /// Messages with an invalid length or checksum are skipped one byte at a time
+        /// until the next valid message is found.
+        /// </remarks>
+        public static DigitalInputStateColumns Read(Stream stream)
+        {
+            var seconds = new double[1 << 17];
+            var states = new DigitalInputs[seconds.Length];
+            var count = 0;
+            HarpMessageScanner.Scan(stream, (address, payloadType, timestamp, buffer, payloadOffset, payloadLength) =>
+            {
+                if (count + DigitalInputStateBatch.SampleCount > seconds.Length)
+                {
+                    Array.Resize(ref seconds, seconds.Length * 2);
+                    Array.Resize(ref states, states.Length * 2);
+                }
+
+                count += Decode(address, payloadType, timestamp, buffer, payloadOffset, payloadLength, seconds, states, count);
+            });
+
+            Array.Resize(ref seconds, count);
+            Array.Resize(ref states, count);
+            return new DigitalInputStateColumns(seconds, states);
+        }
+
+        static int Decode(int address, int payloadType, double timestamp, byte[] buffer, int payloadOffset, int payloadLength, double[] seconds, DigitalInputs[] states, int index)
+        {
+            if (payloadType != HarpMessageScanner.TypeU16 ||
+                address != DigitalInputState.Address && address != DigitalInputStateBatch.Address)
+            {
+                return 0;
+            }
+
+            var valueCount = payloadLength / sizeof(ushort);
+            if (address == DigitalInputState.Address)
+            {
+                if (valueCount < 1) return 0;
+                seconds[index] = timestamp;
+                states[index] = (DigitalInputs)HarpMessageScanner.ReadUInt16(buffer, payloadOffset);
+                return 1;
+            }
+
+            var sampleCount = Math.Min(valueCount - 1, DigitalInputStateBatch.SampleCount);
+            if (sampleCount < 1) return 0;
+            var period = HarpMessageScanner.ReadUInt16(buffer, payloadOffset) * 1e-6;
+            for (int i = 0; i < sampleCount; i++)
+            {
+                payloadOffset += sizeof(ushort);
+                seconds[index + i] = timestamp + i * period;
+                states[index + i] = (DigitalInputs)HarpMessageScanner.ReadUInt16(buffer, payloadOffset);
+            }
+
+            return sampleCount;
+        }
+    }
+
+    /// <summary>
+    /// Represents the digital input readings decoded from a recording, stored as
+    /// parallel arrays of timestamps and input states.
+    /// </summary>
+    public class DigitalInputStateColumns
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="DigitalInputStateColumns"/> class
+        /// with the specified timestamps and input states.
+        /// </summary>
+        /// <param name="seconds">The timestamp of each reading, in seconds.</param>
+        /// <param name="states">The state of the digital inputs in each reading.</param>
+        public DigitalInputStateColumns(double[] seconds, DigitalInputs[] states)
+        {
+            if (seconds == null) throw new ArgumentNullException(nameof(seconds));
+            if (states == null) throw new ArgumentNullException(nameof(states));
+            if (seconds.Length != states.Length)
+            {
+                throw new ArgumentException("The timestamp and state arrays must have the same length.", nameof(states));
+            }
+
+            Seconds = seconds;
+            States = states;
+        }
+
+        /// <summary>
+        /// Gets the number of digital input readings.
+        /// </summary>
+        public int Count => Seconds.Length;
+
+        /// <summary>
+        /// Gets the timestamp of each digital input reading, in seconds.
+        /// </summary>
+        public double[] Seconds { get; }
+
+        /// <summary>
+        /// Gets the state of the digital inputs in each reading.
+        /// </summary>
+        public DigitalInputs[] States { get; }
+    }
+}
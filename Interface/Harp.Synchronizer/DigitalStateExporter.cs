@@ -0,0 +1,164 @@
+using System;
+using System.IO;
+using System.Text;
+
+namespace Harp.Synchronizer
+{
+    /// <summary>
+    /// Provides methods for exporting the digital input and output states in recorded
+    /// binary files of raw <see cref="Synchronizer"/> device messages into columnar files.
+    /// </summary>
+    /// <remarks>
+    /// Each column is written to its own NumPy (.npy) file in the output directory:
+    /// <c>seconds</c>, <c>register</c>, one boolean column per input line <c>DI0</c> to <c>DI8</c>
+    /// and <c>DO0</c>. Each row is one reading of <see cref="DigitalInputState"/>,
+    /// <see cref="DigitalInputStateBatch"/> or <see cref="DigitalOutputState"/>, and the
+    /// input and output columns hold the last known state of each line at that time.
+    /// The input state readings also reflect the state of <c>DO0</c> in bit 13.
+    /// </remarks>
+    public static class DigitalStateExporter
+    {
+        const int InputCount = 9;
+        const int OutputStateBit = 13;
+
+        /// <summary>
+        /// Exports the digital input and output states in a binary file into one column file
+        /// per field, streaming the recording so memory use does not depend on its size.
+        /// </summary>
+        /// <param name="fileName">The path to the binary file containing the raw device messages.</param>
+        /// <param name="outputDirectory">The directory where the column files are created.</param>
+        /// <returns>The number of rows written to each column file.</returns>
+        public static long Export(string fileName, string outputDirectory)
+        {
+            Directory.CreateDirectory(outputDirectory);
+            using (var stream = new FileStream(fileName, FileMode.Open, FileAccess.Read, FileShare.Read, 4096, FileOptions.SequentialScan))
+            using (var writer = new ColumnWriter(outputDirectory))
+            {
+                HarpMessageScanner.Scan(stream, writer.Write);
+                return writer.Count;
+            }
+        }
+
+        class ColumnWriter : IDisposable
+        {
+            readonly NpyWriter seconds;
+            readonly NpyWriter register;
+            readonly NpyWriter[] inputs = new NpyWriter[InputCount];
+            readonly NpyWriter output;
+            int inputState;
+            int outputState;
+
+            public ColumnWriter(string outputDirectory)
+            {
+                seconds = new NpyWriter(Path.Combine(outputDirectory, "seconds.npy"), "<f8");
+                register = new NpyWriter(Path.Combine(outputDirectory, "register.npy"), "|u1");
+                for (int i = 0; i < inputs.Length; i++)
+                {
+                    inputs[i] = new NpyWriter(Path.Combine(outputDirectory, $"DI{i}.npy"), "|b1");
+                }
+                output = new NpyWriter(Path.Combine(outputDirectory, "DO0.npy"), "|b1");
+            }
+
+            public long Count { get; private set; }
+
+            public void Write(int address, int payloadType, double timestamp, byte[] buffer, int payloadOffset, int payloadLength)
+            {
+                if (address == DigitalInputState.Address && payloadType == HarpMessageScanner.TypeU16)
+                {
+                    if (payloadLength < sizeof(ushort)) return;
+                    inputState = HarpMessageScanner.ReadUInt16(buffer, payloadOffset);
+                    outputState = inputState >> OutputStateBit;
+                    WriteRow(timestamp, address);
+                }
+                else if (address == DigitalInputStateBatch.Address && payloadType == HarpMessageScanner.TypeU16)
+                {
+                    var sampleCount = Math.Min(payloadLength / sizeof(ushort) - 1, DigitalInputStateBatch.SampleCount);
+                    if (sampleCount < 1) return;
+                    var period = HarpMessageScanner.ReadUInt16(buffer, payloadOffset) * 1e-6;
+                    for (int i = 0; i < sampleCount; i++)
+                    {
+                        payloadOffset += sizeof(ushort);
+                        inputState = HarpMessageScanner.ReadUInt16(buffer, payloadOffset);
+                        outputState = inputState >> OutputStateBit;
+                        WriteRow(timestamp + i * period, address);
+                    }
+                }
+                else if (address == DigitalOutputState.Address && payloadType == HarpMessageScanner.TypeU8)
+                {
+                    if (payloadLength < sizeof(byte)) return;
+                    outputState = buffer[payloadOffset];
+                    WriteRow(timestamp, address);
+                }
+            }
+
+            void WriteRow(double timestamp, int address)
+            {
+                seconds.Write(timestamp);
+                register.Write((byte)address);
+                for (int i = 0; i < inputs.Length; i++)
+                {
+                    inputs[i].Write((byte)((inputState >> i) & 1));
+                }
+                output.Write((byte)(outputState & 1));
+                Count++;
+            }
+
+            public void Dispose()
+            {
+                seconds.Dispose();
+                register.Dispose();
+                for (int i = 0; i < inputs.Length; i++)
+                {
+                    inputs[i].Dispose();
+                }
+                output.Dispose();
+            }
+        }
+
+        class NpyWriter : IDisposable
+        {
+            const int HeaderSize = 128;
+            readonly FileStream stream;
+            readonly BinaryWriter writer;
+            readonly string descr;
+            long count;
+
+            public NpyWriter(string path, string descr)
+            {
+                this.descr = descr;
+                stream = new FileStream(path, FileMode.Create, FileAccess.Write, FileShare.None, 1 << 16);
+                writer = new BinaryWriter(stream);
+                WriteHeader();
+            }
+
+            public void Write(double value)
+            {
+                writer.Write(value);
+                count++;
+            }
+
+            public void Write(byte value)
+            {
+                writer.Write(value);
+                count++;
+            }
+
+            void WriteHeader()
+            {
+                var header = $"{{'descr': '{descr}', 'fortran_order': False, 'shape': ({count},), }}";
+                header = header.PadRight(HeaderSize - 11) + "\n";
+                writer.Write(new byte[] { 0x93, (byte)'N', (byte)'U', (byte)'M', (byte)'P', (byte)'Y', 1, 0 });
+                writer.Write((ushort)header.Length);
+                writer.Write(Encoding.ASCII.GetBytes(header));
+            }
+
+            public void Dispose()
+            {
+                writer.Flush();
+                stream.Position = 0;
+                WriteHeader();
+                writer.Dispose();
+            }
+        }
+    }
+}
@@ -0,0 +1,119 @@
+using System;
+using System.IO;
+
+namespace Harp.Synchronizer
+{
+    /// <summary>
+    /// Represents a method that handles a timestamped message found in a recording.
+    /// </summary>
+    /// <param name="address">The address of the register in the message.</param>
+    /// <param name="payloadType">The type of the payload, without the timestamp flag.</param>
+    /// <param name="seconds">The timestamp of the message, in seconds.</param>
+    /// <param name="buffer">The buffer holding the message.</param>
+    /// <param name="payloadOffset">The offset of the payload in the buffer.</param>
+    /// <param name="payloadLength">The number of bytes in the payload.</param>
+    internal delegate void TimestampedMessageHandler(int address, int payloadType, double seconds, byte[] buffer, int payloadOffset, int payloadLength);
+
+    /// <summary>
+    /// Provides the framing of recorded binary files of raw <see cref="Synchronizer"/>
+    /// device messages, shared by the decoders of the recordings.
+    /// </summary>
+    internal static class HarpMessageScanner
+    {
+        internal const int TypeU8 = 0x01;
+        internal const int TypeU16 = 0x02;
+
+        const int ChunkSize = 1 << 20;
+        const int MinMessageSize = 6;
+        const int TimestampedHeaderSize = 11;
+        const int ErrorFlag = 0x08;
+        const int TimestampFlag = 0x10;
+        const double MicrosTickPeriod = 32e-6;
+
+        /// <summary>
+        /// Reads the stream in chunks and calls the handler for each valid timestamped
+        /// message that doesn't report an error, in the order they were recorded.
+        /// </summary>
+        /// <remarks>
+        /// Messages with an invalid length or checksum are skipped one byte at a time
+        /// until the next valid message is found.
+        /// </remarks>
+        internal static void Scan(Stream stream, TimestampedMessageHandler handler)
+        {
+            var buffer = new byte[ChunkSize];
+            var available = 0;
+            while (true)
+            {
+                var bytesRead = stream.Read(buffer, available, buffer.Length - available);
+                available += bytesRead;
+
+                var offset = 0;
+                while (available - offset >= MinMessageSize)
+                {
+                    var messageSize = buffer[offset + 1] + 2;
+                    if (messageSize < MinMessageSize)
+                    {
+                        offset++;
+                        continue;
+                    }
+
+                    if (available - offset < messageSize)
+                    {
+                        if (bytesRead > 0) break;
+                        offset++;
+                        continue;
+                    }
+
+                    if (!IsValid(buffer, offset, messageSize))
+                    {
+                        offset++;
+                        continue;
+                    }
+
+                    var payloadType = buffer[offset + 4];
+                    if (messageSize > TimestampedHeaderSize &&
+                        (buffer[offset] & ErrorFlag) == 0 &&
+                        (payloadType & TimestampFlag) != 0)
+                    {
+                        var seconds = ReadUInt32(buffer, offset + 5) + ReadUInt16(buffer, offset + 9) * MicrosTickPeriod;
+                        handler(
+                            buffer[offset + 2],
+                            payloadType & ~TimestampFlag,
+                            seconds,
+                            buffer,
+                            offset + TimestampedHeaderSize,
+                            messageSize - TimestampedHeaderSize - 1);
+                    }
+
+                    offset += messageSize;
+                }
+
+                if (bytesRead == 0) break;
+                Buffer.BlockCopy(buffer, offset, buffer, 0, available - offset);
+                available -= offset;
+            }
+        }
+
+        static bool IsValid(byte[] buffer, int offset, int messageSize)
+        {
+            byte checksum = 0;
+            var end = offset + messageSize - 1;
+            for (int i = offset; i < end; i++)
+            {
+                checksum += buffer[i];
+            }
+
+            return checksum == buffer[end];
+        }
+
+        internal static ushort ReadUInt16(byte[] buffer, int offset)
+        {
+            return (ushort)(buffer[offset] | buffer[offset + 1] << 8);
+        }
+
+        internal static uint ReadUInt32(byte[] buffer, int offset)
+        {
+            return (uint)(buffer[offset] | buffer[offset + 1] << 8 | buffer[offset + 2] << 16 | buffer[offset + 3] << 24);
+        }
+    }
+}
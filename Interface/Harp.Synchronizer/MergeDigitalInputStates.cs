@@ -0,0 +1,226 @@
+using Bonsai;
+using Bonsai.Harp;
+using System;
+using System.Collections.Generic;
+using System.ComponentModel;
+using System.Reactive;
+using System.Reactive.Disposables;
+using System.Reactive.Linq;
+
+namespace Harp.Synchronizer
+{
+    /// <summary>
+    /// Represents a digital input reading tagged with the address of the
+    /// <see cref="Synchronizer"/> device that reported it.
+    /// </summary>
+    public struct DeviceDigitalInputs
+    {
+        const int AddressShift = 14;
+
+        /// <summary>
+        /// Initializes a new instance of the <see cref="DeviceDigitalInputs"/> structure
+        /// from a raw digital input state, which includes the device address bits.
+        /// </summary>
+        /// <param name="state">The raw state reported by the <see cref="DigitalInputState"/> register.</param>
+        public DeviceDigitalInputs(DigitalInputs state)
+        {
+            Address = GetAddress(state);
+            Inputs = state & DigitalInputEdgeColumns.AllInputs;
+        }
+
+        /// <summary>
+        /// Gets the address of the device, set by its address pins, in the range 0 to 3.
+        /// </summary>
+        public int Address { get; }
+
+        /// <summary>
+        /// Gets the state of the digital input lines.
+        /// </summary>
+        public DigitalInputs Inputs { get; }
+
+        /// <summary>
+        /// Returns the device address encoded in bits 14 and 15 of a raw digital input state.
+        /// </summary>
+        /// <param name="state">The raw state reported by the <see cref="DigitalInputState"/> register.</param>
+        /// <returns>The address of the device, in the range 0 to 3.</returns>
+        public static int GetAddress(DigitalInputs state)
+        {
+            return ((int)state >> AddressShift) & 0x3;
+        }
+
+        /// <inheritdoc/>
+        public override string ToString()
+        {
+            return $"{Address}: {Inputs}";
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that merges the digital input readings of several
+    /// <see cref="Synchronizer"/> devices sharing a clock into a single sequence
+    /// ordered by timestamp.
+    /// </summary>
+    /// <remarks>
+    /// Readings are held until every source that has not completed has reported a
+    /// reading at least as recent, so the merged sequence is delayed by the slowest source.
+    /// A reading is released without waiting when it is older than the newest reading of
+    /// any source by more than <see cref="MaxDelay"/>, or when its source buffers more than
+    /// <see cref="Capacity"/> readings. Readings reported later by an idle source with an
+    /// older timestamp are then emitted out of order, as soon as they arrive.
+    /// </remarks>
+    [Combinator]
+    [WorkflowElementCategory(ElementCategory.Combinator)]
+    [Description("Merges the digital input readings of several devices into a single sequence ordered by timestamp.")]
+    public class MergeDigitalInputStates
+    {
+        /// <summary>
+        /// Gets or sets the maximum number of readings buffered for each source
+        /// while waiting for the other sources.
+        /// </summary>
+        [Description("The maximum number of readings buffered for each source while waiting for the other sources.")]
+        public int Capacity { get; set; } = 1024;
+
+        /// <summary>
+        /// Gets or sets the maximum time, in seconds, that a reading waits for the other
+        /// sources, measured against the newest reading of any source. If no value is
+        /// specified, readings wait until every source reports or <see cref="Capacity"/> is exceeded.
+        /// </summary>
+        [Description("The maximum time, in seconds, that a reading waits for the other sources, measured against the newest reading of any source.")]
+        public double? MaxDelay { get; set; } = 1;
+
+        /// <summary>
+        /// Merges the timestamped digital input readings of several devices into a single
+        /// sequence ordered by timestamp, tagging each reading with its device address.
+        /// </summary>
+        /// <param name="sources">The sequences of timestamped digital input readings of each device.</param>
+        /// <returns>
+        /// A sequence of timestamped digital input readings from all devices, ordered by timestamp.
+        /// </returns>
+        public IObservable<Timestamped<DeviceDigitalInputs>> Process(params IObservable<Timestamped<DigitalInputs>>[] sources)
+        {
+            return Observable.Create<Timestamped<DeviceDigitalInputs>>(observer =>
+            {
+                var gate = new object();
+                var capacity = Math.Max(1, Capacity);
+                var maxDelay = MaxDelay.HasValue ? Math.Max(0, MaxDelay.Value) : double.PositiveInfinity;
+                var newest = double.NegativeInfinity;
+                var queues = new Queue<Timestamped<DigitalInputs>>[sources.Length];
+                var watermarks = new double[sources.Length];
+                var completed = new bool[sources.Length];
+                var completedCount = 0;
+                for (int i = 0; i < sources.Length; i++)
+                {
+                    queues[i] = new Queue<Timestamped<DigitalInputs>>();
+                    watermarks[i] = double.NegativeInfinity;
+                }
+
+                void Drain()
+                {
+                    while (true)
+                    {
+                        var next = -1;
+                        var overflow = false;
+                        for (int i = 0; i < queues.Length; i++)
+                        {
+                            if (queues[i].Count == 0) continue;
+                            if (queues[i].Count > capacity) overflow = true;
+                            if (next < 0 || queues[i].Peek().Seconds < queues[next].Peek().Seconds)
+                            {
+                                next = i;
+                            }
+                        }
+
+                        if (next < 0) return;
+                        var seconds = queues[next].Peek().Seconds;
+                        if (!overflow && seconds >= newest - maxDelay)
+                        {
+                            for (int i = 0; i < queues.Length; i++)
+                            {
+                                if (queues[i].Count == 0 && !completed[i] && watermarks[i] < seconds) return;
+                            }
+                        }
+
+                        var value = queues[next].Dequeue();
+                        observer.OnNext(Timestamped.Create(new DeviceDigitalInputs(value.Value), value.Seconds));
+                    }
+                }
+
+                var subscriptions = new CompositeDisposable();
+                for (int i = 0; i < sources.Length; i++)
+                {
+                    var index = i;
+                    subscriptions.Add(sources[i].Subscribe(Observer.Create<Timestamped<DigitalInputs>>(
+                        value =>
+                        {
+                            lock (gate)
+                            {
+                                watermarks[index] = value.Seconds;
+                                newest = Math.Max(newest, value.Seconds);
+                                queues[index].Enqueue(value);
+                                Drain();
+                            }
+                        },
+                        error =>
+                        {
+                            lock (gate) observer.OnError(error);
+                        },
+                        () =>
+                        {
+                            lock (gate)
+                            {
+                                completed[index] = true;
+                                Drain();
+                                if (++completedCount == sources.Length)
+                                {
+                                    observer.OnCompleted();
+                                }
+                            }
+                        })));
+                }
+
+                return subscriptions;
+            });
+        }
+
+        /// <summary>
+        /// Merges the digital input readings of several recordings into a single recording
+        /// ordered by timestamp. Readings with the same timestamp are ordered by recording.
+        /// </summary>
+        /// <param name="recordings">The recorded digital input readings of each device.</param>
+        /// <returns>
+        /// A <see cref="DigitalInputStateColumns"/> object holding the readings of all recordings,
+        /// with the device address bits of each state preserved.
+        /// </returns>
+        public static DigitalInputStateColumns Merge(params DigitalInputStateColumns[] recordings)
+        {
+            if (recordings == null) throw new ArgumentNullException(nameof(recordings));
+            var count = 0;
+            for (int i = 0; i < recordings.Length; i++)
+            {
+                count += recordings[i].Count;
+            }
+
+            var seconds = new double[count];
+            var states = new DigitalInputs[count];
+            var positions = new int[recordings.Length];
+            for (int index = 0; index < count; index++)
+            {
+                var next = -1;
+                for (int i = 0; i < recordings.Length; i++)
+                {
+                    if (positions[i] >= recordings[i].Count) continue;
+                    if (next < 0 || recordings[i].Seconds[positions[i]] < recordings[next].Seconds[positions[next]])
+                    {
+                        next = i;
+                    }
+                }
+
+                seconds[index] = recordings[next].Seconds[positions[next]];
+                states[index] = recordings[next].States[positions[next]];
+                positions[next]++;
+            }
+
+            return new DigitalInputStateColumns(seconds, states);
+        }
+    }
+}